@@ -36,6 +36,10 @@ BS_API auto forward_caf_error(const caf::error& er, std::string_view msg = {}, b
 // [TODO] bring back after issue resolved
 //inline constexpr auto high_prio = caf::message_priority::high;
 inline constexpr auto high_prio = caf::message_priority::normal;
+/// priority of interactive requests (reads issued by UI)
+// [NOTE] kept at normal priority until issue with high prio messages is resolved,
+// urgent request can also overtake preceding writes of same thread and miss them
+inline constexpr auto interactive_prio = caf::message_priority::normal;
 
 NAMESPACE_BEGIN(detail)
 namespace cd = caf::detail;
@@ -172,33 +176,48 @@ auto actorf(caf::function_view<Actor>& factor, Args&&... args) {
 	return res.get();
 }
 
-/// operates on passed `scoped_actor` instead of function view
-template<typename R, typename Actor, typename... Args>
-auto actorf(const caf::scoped_actor& caller, const Actor& tgt, timespan timeout, Args&&... args) {
-	// setup placeholder for request result
-	using res_keeper = detail::afres_keeper<R>;
-	using R_ = typename res_keeper::R;
-	auto res = res_keeper{};
+NAMESPACE_BEGIN(detail)
 
-	// make request & extract response
-	caller->request(tgt, timeout, std::forward<Args>(args)...)
-	.receive(
+// make blocking request & put response into `res`, returns false if CAF error was received
+template<typename Res, typename Actor, typename... Args>
+auto blocking_request(
+	const caf::scoped_actor& caller, Res& res, const Actor& tgt, timespan timeout, Args&&... args
+) -> bool {
+	using R_ = typename Res::R;
+	bool ok = true;
+	// interactive requests bypass normal traffic
+	(kernel::radio::is_interactive() ?
+		caller->template request<interactive_prio>(tgt, timeout, std::forward<Args>(args)...) :
+		caller->request(tgt, timeout, std::forward<Args>(args)...)
+	).receive(
 		[&](R_& value) { res.emplace(std::move(value)); },
-		[&](const caf::error& er) { res.emplace(er); }
+		[&](const caf::error& er) { ok = false; res.emplace(er); }
 	);
+	return ok;
+}
+
+NAMESPACE_END(detail)
 
+/// operates on passed `scoped_actor` instead of function view
+template<typename R, typename Actor, typename... Args>
+auto actorf(const caf::scoped_actor& caller, const Actor& tgt, timespan timeout, Args&&... args) {
+	auto res = detail::afres_keeper<R>{};
+	detail::blocking_request(caller, res, tgt, timeout, std::forward<Args>(args)...);
 	return res.get();
 }
 
-/// constructs scoped actor inside from passed handle & timeout
+/// makes request from blocking actor reused by calling thread
 template<
 	typename R, typename Actor, typename... Args,
 	typename = detail::if_actor_handle<Actor>
 >
 auto actorf(const Actor& tgt, timespan timeout, Args&&... args) {
-	return actorf<R>(
-		caf::scoped_actor{kernel::radio::system()}, tgt, timeout, std::forward<Args>(args)...
-	);
+	auto res = detail::afres_keeper<R>{};
+	auto caller = kernel::radio::blocking_caller{};
+	// [NOTE] response to timed out request can arrive later & stay in caller's mailbox forever
+	if(!detail::blocking_request(*caller, res, tgt, timeout, std::forward<Args>(args)...))
+		caller.discard();
+	return res.get();
 }
 
 /// inplace match of given behavior and message, returns result of `sending` message to behavior
@@ -249,7 +268,7 @@ auto anon_request(Actor A, timespan timeout, bool high_priority, F f, Args&&...
 	] (caf::event_based_actor* self) mutable {
 		std::apply([self, high_priority, t, A = std::move(A)](auto&&... args) {
 			return high_priority ?
-				self->request<high_prio>(A, t, std::forward<decltype(args)>(args)...) :
+				self->request<interactive_prio>(A, t, std::forward<decltype(args)>(args)...) :
 				self->request(A, t, std::forward<decltype(args)>(args)...);
 		}, std::move(args))
 		.then(detail::closed_functor<F>::make(std::move(f), self));
@@ -285,7 +304,7 @@ auto anon_request_result(Actor A, timespan timeout, bool high_priority, F f, Arg
 		// make request
 		std::apply([self, high_priority, t, A = std::move(A)](auto&&... args) {
 			return high_priority ?
-				self->template request<high_prio>(A, t, std::forward<decltype(args)>(args)...) :
+				self->template request<interactive_prio>(A, t, std::forward<decltype(args)>(args)...) :
 				self->request(A, t, std::forward<decltype(args)>(args)...);
 		}, std::move(args))
 		// [NOTE] use `await` to prevent `a_ack` processing while query processing not finished
@@ -324,6 +343,15 @@ auto first_then_second(caf::behavior first, caf::typed_behavior<SigsB...> second
 	.or_else( std::move(second.unbox()) );
 }
 
+NAMESPACE_BEGIN(detail)
+/// check if message composed from `Ts` matches typed iface of `ActorType`
+template<typename ActorType, typename... Ts>
+inline constexpr bool accepts_message_v = caf::response_type_unbox<
+	caf::signatures_of_t<ActorType>, caf::detail::type_list<caf::detail::strip_and_convert_t<Ts>...>
+>::valid;
+
+NAMESPACE_END(detail)
+
 /// @brief send to a group with compie-time check message against explicitly provided group typed iface
 template<
 	typename GroupActorType,
@@ -332,15 +360,23 @@ template<
 auto checked_send(ActorClass& src, const caf::group& dest, Ts&&... xs) -> void {
 	// check if GroupSigs match with Ts
 	static_assert(sizeof...(Ts) > 0, "no message to send");
-	using args_token_t = caf::detail::type_list<caf::detail::strip_and_convert_t<Ts>...>;
-	static_assert(
-		caf::response_type_unbox<caf::signatures_of_t<GroupActorType>, args_token_t>::valid,
-		"receiver does not accept given message"
-	);
+	static_assert(detail::accepts_message_v<GroupActorType, Ts...>, "receiver does not accept given message");
 	// resort to actor's `send`
 	src.template send<P>(dest, std::forward<Ts>(xs)...);
 }
 
+/// @brief same as above, but message is sent directly to dynamically typed actor that is known
+/// to be a member of group with given iface
+template<
+	typename GroupActorType,
+	caf::message_priority P = caf::message_priority::normal, typename ActorClass, typename... Ts
+>
+auto checked_send(ActorClass& src, const caf::actor& dest, Ts&&... xs) -> void {
+	static_assert(sizeof...(Ts) > 0, "no message to send");
+	static_assert(detail::accepts_message_v<GroupActorType, Ts...>, "receiver does not accept given message");
+	src.template send<P>(dest, std::forward<Ts>(xs)...);
+}
+
 /// @brief same as above but with anon send (no source actor available)
 template<
 	typename GroupActorType,
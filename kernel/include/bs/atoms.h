@@ -48,6 +48,8 @@ CAF_BEGIN_TYPE_ID_BLOCK(bs_atoms, first_custom_type_id)
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_save)
 	// subscription manage
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_subscribe)
+	// deliver accumulated data
+	CAF_ADD_ATOM(bs_atoms, blue_sky, a_flush)
 	// ask to clone some object
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_clone)
 
@@ -86,6 +88,7 @@ CAF_BEGIN_TYPE_ID_BLOCK(bs_atoms, first_custom_type_id)
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_node_insert)
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_node_erase)
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_node_clear)
+	CAF_ADD_ATOM(bs_atoms, blue_sky, a_node_stats)
 
 	// query node's actor group ID
 	CAF_ADD_ATOM(bs_atoms, blue_sky, a_node_disconnect)
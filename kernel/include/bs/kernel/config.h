@@ -15,6 +15,9 @@
 #include <caf/config_option_adder.hpp>
 #include <caf/settings.hpp>
 
+#include <optional>
+#include <string_view>
+
 NAMESPACE_BEGIN(blue_sky::kernel::config)
 
 /// configure kernel
@@ -27,6 +30,12 @@ BS_API auto is_configured() -> bool;
 /// access to kernel's config variables
 BS_API auto config() -> const caf::settings&;
 
+/// set single config variable in memory (config files aren't touched), empty `value` erases variable
+/// returns previous value of variable, if any, so it can be restored later
+/// [NOTE] not synchronized with concurrent config reads, intended for setup code & tests
+BS_API auto set(std::string_view key, std::optional<caf::config_value> value)
+-> std::optional<caf::config_value>;
+
 /// allows to add custom options to specified config section
 BS_API auto config_section(std::string_view name) -> caf::config_option_adder;
 /// access global CAF actor_system_config
@@ -13,6 +13,8 @@
 
 #include <caf/fwd.hpp>
 
+#include <memory>
+
 NAMESPACE_BEGIN(blue_sky::kernel::radio)
 
 /// access actor system
@@ -21,6 +23,48 @@ BS_API auto system() -> caf::actor_system&;
 /// obtain configured timeout for actor requests
 BS_API auto timeout(bool for_long_task = false) -> timespan;
 
+/// while scope is alive, blocking requests made by calling thread via `actorf()` are sent
+/// with `interactive_prio`, meant for interactive (UI) reads
+/// [NOTE] currently `interactive_prio` is normal priority, so requests keep their order
+class BS_API interactive_scope {
+public:
+	/// scope with `on = false` keeps current mode, nested scopes can't switch interactive mode off
+	interactive_scope(bool on = true);
+	~interactive_scope();
+
+	interactive_scope(const interactive_scope&) = delete;
+	auto operator=(const interactive_scope&) -> interactive_scope& = delete;
+
+private:
+	bool prev_;
+};
+
+/// check if requests of calling thread are interactive
+BS_API auto is_interactive() -> bool;
+
+/// blocking actor that makes synchronous requests on behalf of calling thread
+/// [NOTE] actor is created once per thread and reused by consecutive requests,
+/// nested caller (while thread's actor is taken) gets fresh actor
+class BS_API blocking_caller {
+public:
+	blocking_caller();
+	~blocking_caller();
+
+	blocking_caller(const blocking_caller&) = delete;
+	auto operator=(const blocking_caller&) -> blocking_caller& = delete;
+
+	auto operator*() const -> caf::scoped_actor& { return *self_; }
+
+	/// don't return actor to thread's pool, because late response to failed request
+	/// can arrive into it's mailbox
+	auto discard() -> void { discard_ = true; }
+
+private:
+	caf::scoped_actor* self_;
+	std::unique_ptr<caf::scoped_actor> own_;
+	bool discard_ = false;
+};
+
 /// obtain actor with given ID from registry and sends it `a_bye` message
 /// returns whether actor was found
 BS_API auto bye_actor(std::uint64_t actor_id) -> bool;
@@ -28,6 +72,10 @@ BS_API auto bye_actor(std::uint64_t actor_id) -> bool;
 /// starts or stops transmitter
 BS_API auto toggle(bool on = true) -> void;
 
+/// respawn executors of link transactions according to current "tree.link_shards" config value
+/// [NOTE] must not be called while link transactions are running
+BS_API auto restart_link_shards() -> void;
+
 BS_API auto start_server() -> void;
 
 BS_API auto start_client(const std::string& host) -> error;
@@ -10,6 +10,7 @@
 #include "../common.h"
 #include "../error.h"
 #include "../uuid.h"
+#include "../timetypes.h"
 #include "../transaction.h"
 #include "../detail/enumops.h"
 #include "../detail/function_view.h"
@@ -104,6 +105,51 @@ struct BS_API event {
 	auto origin_object() const -> sp_obj;
 };
 
+/// events coalescing options of subscriber
+/// batched event code is union of codes of all coalesced events, it's params are:
+/// "lids" - IDs of affected links, "events" - aggregated event flags of every link from "lids",
+/// "count" - number of coalesced events
+/// [NOTE] status transitions of same link are merged, so link that returned to initial status
+/// don't get `LinkStatusChanged` flag
+struct BS_API event_batch_opts {
+	/// max period between first event in batch and batch delivery, zero disables timer
+	timespan window = timespan::zero();
+	/// deliver batch when it contains given number of events, zero means unlimited
+	std::size_t max_count = 0;
+
+	auto enabled() const -> bool {
+		return window > timespan::zero() || max_count > 0;
+	}
+};
+
+/// what subscriber's events queue does with new event when it's full
+/// [NOTE] events are multicasted by tree engines that never wait for subscribers,
+/// so memory is bounded only by dropping or merging pending events
+enum class EventOverflow : std::uint32_t {
+	/// oldest pending event is dropped
+	DropOldest = 0,
+	/// pending event of same link & code is replaced with new one, otherwise oldest is dropped
+	CoalesceLatest = 1
+};
+
+/// bounded queue of events pending for subscriber's callback
+/// [NOTE] callback of subscriber with bounded queue is invoked from dedicated thread
+struct BS_API event_queue_opts {
+	/// max number of pending events, zero means unbounded queue
+	std::size_t capacity = 0;
+	EventOverflow overflow = EventOverflow::DropOldest;
+
+	auto bounded() const -> bool { return capacity > 0; }
+};
+
+/// counters of subscriber's events queue
+struct BS_API event_queue_stats {
+	std::size_t pending = 0;
+	std::uint64_t delivered = 0;
+	std::uint64_t dropped = 0;
+	std::uint64_t coalesced = 0;
+};
+
 NAMESPACE_END(blue_sky::tree)
 
 BS_ALLOW_ENUMOPS(tree::Event)
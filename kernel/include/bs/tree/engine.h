@@ -104,6 +104,10 @@ public:
 	/// check whether engine is valid
 	auto has_engine() const noexcept -> bool;
 
+	/// check if engine's actor is already spawned
+	/// [NOTE] actor is started lazily on first access to it
+	auto has_actor() const noexcept -> bool;
+
 	auto swap(engine& rhs) noexcept -> void;
 
 	/*
@@ -121,24 +125,30 @@ public:
 	/// returns engine's string type ID
 	auto type_id() const -> std::string_view;
 
-	/// get engine's home group
-	auto home() const -> const caf::group&;
+	/// get engine's home group, group is created on first access
+	auto home() const -> caf::group;
 
-	/// get engine's home group ID (empty for invalid / not started home)
-	auto home_id() const -> std::string_view;
+	/// get engine's home group ID, valid even if group isn't created yet
+	auto home_id() const -> std::string;
 
 	/// unsubscribe event handler with known ID
 	static auto unsubscribe(std::uint64_t event_cb_id) -> void;
+	/// counters of bounded events queue of handler with known ID
+	/// zeros are returned if handler's queue is unbounded or handler is already gone
+	static auto subscriber_stats(std::uint64_t event_cb_id) -> event_queue_stats;
 	/// unsubscribe all self event handlers
 	auto unsubscribe() const -> void;
 
 protected:
-	/// return engine's raw (dynamic-typed) actor handle
+	/// return engine's raw (dynamic-typed) actor handle, lazy actor is spawned here on first call
+	/// [NOTE] throws if spawning lazy actor failed, spawn is retried on next call
 	// [NOTE] uncheked access
-	auto raw_actor() const noexcept -> const caf::actor&;
+	auto raw_actor() const -> const caf::actor&;
 
 	/// unconditional reset of actor_handle with new one
 	auto install_raw_actor(caf::actor engine_actor) -> void;
+	/// same as above, but actor is spawned by `starter` on first `raw_actor()` call
+	auto install_lazy_actor(std::function<caf::actor()> starter) -> void;
 
 	// strong ref to internal engine's actor
 	// [NOTE] trick with shared ptr to handle is required to correctly track `engine` instances
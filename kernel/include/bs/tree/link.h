@@ -21,6 +21,10 @@
 #include <caf/group.hpp>
 
 NAMESPACE_BEGIN(blue_sky::tree)
+NAMESPACE_BEGIN(detail)
+struct name_key;
+NAMESPACE_END(detail)
+
 /*-----------------------------------------------------------------------------
  *  base class of all links
  *-----------------------------------------------------------------------------*/
@@ -220,8 +224,16 @@ public:
 	using event_handler = std::function< void(event) >;
 
 	/// returns ID of suscriber that is required for unsubscribe
-	auto subscribe(event_handler f, Event listen_to = Event::All) const -> std::uint64_t;
-	auto subscribe(launch_async_t, event_handler f, Event listen_to = Event::All) const -> std::uint64_t;
+	/// if `batch` is enabled, events are coalesced and delivered as single batched event
+	/// if `queue` is bounded, pending events are limited by it's capacity, see `subscriber_stats()`
+	auto subscribe(
+		event_handler f, Event listen_to = Event::All, event_batch_opts batch = {},
+		event_queue_opts queue = {}
+	) const -> std::uint64_t;
+	auto subscribe(
+		launch_async_t, event_handler f, Event listen_to = Event::All, event_batch_opts batch = {},
+		event_queue_opts queue = {}
+	) const -> std::uint64_t;
 	/// unsubscribe handlers from self & whole subtree
 	auto unsubscribe(deep_t) const -> void;
 	using engine::unsubscribe;
@@ -246,6 +258,7 @@ private:
 	friend link_impl;
 	friend link_actor;
 	friend node_impl;
+	friend detail::name_key;
 
 	link(engine&&);
 
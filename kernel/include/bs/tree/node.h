@@ -13,6 +13,7 @@
 #include "../meta/is_container.h"
 #include "../detail/enumops.h"
 
+#include <map>
 #include <optional>
 
 NAMESPACE_BEGIN(blue_sky::tree)
@@ -26,6 +27,20 @@ public:
 	using existing_index = bare_node::existing_index;
 	using insert_status = bare_node::insert_status;
 
+	/// aggregate counters over node's subtree (node itself isn't counted)
+	struct BS_API subtree_stats {
+		/// total number of links in subtree
+		std::uint64_t leafs = 0;
+		/// number of nested nodes in subtree
+		std::uint64_t nodes = 0;
+		/// number of links per pointee object type ID (sym links are counted as untyped)
+		std::map<std::string, std::uint64_t> types;
+
+		auto operator+=(const subtree_stats& rhs) -> subtree_stats&;
+		/// [NOTE] counters are saturated at zero, types with zero count are dropped
+		auto operator-=(const subtree_stats& rhs) -> subtree_stats&;
+	};
+
 	/// Interface of node actor, you can only send messages matching it
 	using actor_type = caf::typed_actor<
 		// get home group
@@ -41,6 +56,9 @@ public:
 
 		// obtain node's content sorted by given order
 		caf::replies_to<a_node_leafs, Key /* order */>::with<links_v>,
+		// obtain window [offset, offset + count) of node's content sorted by given order
+		caf::replies_to<a_node_leafs, Key /* order */, std::size_t /* offset */, std::size_t /* count */>
+		::with<links_v>,
 
 		// obtain leafs keys sorted by given index
 		caf::replies_to<a_node_keys, Key /* order */>::with<lids_v>,
@@ -48,6 +66,11 @@ public:
 		caf::replies_to<a_node_keys, Key /* meaning */, Key /* order */>::with<std::vector<std::string>>,
 		// sorted indexes (offsets)
 		caf::replies_to<a_node_ikeys, Key /* order */>::with<std::vector<std::size_t>>,
+		// windows of sorted ID keys & indexes
+		caf::replies_to<a_node_keys, Key /* order */, std::size_t /* offset */, std::size_t /* count */>
+		::with<lids_v>,
+		caf::replies_to<a_node_ikeys, Key /* order */, std::size_t /* offset */, std::size_t /* count */>
+		::with<std::vector<std::size_t>>,
 
 		// find link by ID
 		caf::replies_to<a_node_find, lid_type>::with<link>,
@@ -86,6 +109,8 @@ public:
 		caf::replies_to<a_node_erase, lids_v>::with<std::size_t>,
 		// clears node content
 		caf::replies_to<a_node_clear>::with<std::size_t>,
+		// aggregate counters over node's subtree
+		caf::replies_to<a_node_stats>::with<subtree_stats>,
 
 		// erase link by ID with specified options
 		caf::replies_to<a_lnk_rename, lid_type, std::string>::with<std::size_t>,
@@ -157,13 +182,24 @@ public:
 	auto clear() const -> std::size_t;
 	auto clear(launch_async_t) const -> void;
 
+	/// aggregate counters over whole subtree
+	/// [NOTE] first call counts subtree, then counters are maintained from leafs acks & read in O(1)
+	/// (if "tree.subtree_stats" config key isn't false), they're eventually consistent with tree
+	auto stats() const -> subtree_stats;
+
 	/// get snapshot of node's content sorted with given order
 	auto leafs(Key order = Key::AnyOrder) const -> links_v;
+	/// get at most `count` leafs sorted with given order starting from `offset`
+	auto leafs(Key order, std::size_t offset, std::size_t count) const -> links_v;
 
 	/// obtain vector of link ID keys, sorted with given order
 	auto keys(Key ordering = Key::AnyOrder) const -> lids_v;
+	/// same as above, but returns only window [offset, offset + count)
+	auto keys(Key ordering, std::size_t offset, std::size_t count) const -> lids_v;
 	/// obtain vector of link indexes (offsets from beginning)
 	auto ikeys(Key ordering = Key::AnyOrder) const -> std::vector<std::size_t>;
+	/// same as above, but returns only window [offset, offset + count)
+	auto ikeys(Key ordering, std::size_t offset, std::size_t count) const -> std::vector<std::size_t>;
 	/// obtain vector of leafs keys of `key_meaning` index type sorted by `ordering` key
 	auto skeys(Key key_meaning, Key ordering = Key::AnyOrder) const -> std::vector<std::string>;
 
@@ -222,6 +258,9 @@ public:
 	auto erase(std::string key, Key key_meaning) const -> std::size_t;
 	/// erase bunch of leafs with given IDs
 	auto erase(lids_v r) const -> std::size_t;
+	/// same as above, but doesn't wait until leafs are erased
+	/// [NOTE] IDs of erased subtree are collected in separate thread, not by worker of node's actor
+	auto erase(launch_async_t, lids_v r) const -> void;
 
 	/// rename link at given position
 	auto rename(std::size_t idx, std::string new_name) const -> bool;
@@ -244,8 +283,18 @@ public:
 	using event_handler = std::function< void(node /* root */, event) >;
 
 	/// returns ID of suscriber that is required for unsubscribe
-	auto subscribe(event_handler f, Event listen_to = Event::All) const -> std::uint64_t;
-	auto subscribe(launch_async_t, event_handler f, Event listen_to = Event::All) const -> std::uint64_t;
+	/// if `batch` is enabled, events are coalesced and delivered as single batched event
+	/// without `TreeOpts::Deep` in `opts` only events of direct leafs are delivered
+	/// if `queue` is bounded, pending events are limited by it's capacity, see `subscriber_stats()`
+	/// [NOTE] `listen_to` & `opts` are registered with node, so events nobody listens to aren't sent
+	auto subscribe(
+		event_handler f, Event listen_to = Event::All, event_batch_opts batch = {},
+		TreeOpts opts = TreeOpts::Deep, event_queue_opts queue = {}
+	) const -> std::uint64_t;
+	auto subscribe(
+		launch_async_t, event_handler f, Event listen_to = Event::All, event_batch_opts batch = {},
+		TreeOpts opts = TreeOpts::Deep, event_queue_opts queue = {}
+	) const -> std::uint64_t;
 	/// unsubscribe handlers from self & whole subtree
 	auto unsubscribe(deep_t) const -> void;
 	using engine::unsubscribe;
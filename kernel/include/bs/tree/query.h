@@ -0,0 +1,76 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Predicate queries over BS tree subtrees
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+#pragma once
+
+#include "tree.h"
+
+NAMESPACE_BEGIN(blue_sky::tree)
+
+/*-----------------------------------------------------------------------------
+ *  Composable predicate on links
+ *-----------------------------------------------------------------------------*/
+/// index-able parts (exact match of ID, OID, name or type) are pushed down to node indexes,
+/// the rest is checked only for links that passed index lookup
+class BS_API query {
+public:
+	using link_pred_f = std::function<bool(const link&)>;
+	using obj_pred_f = std::function<bool(const sp_obj&)>;
+
+	/// matches any link
+	query();
+
+	/// exact match of `key` of given meaning (ID, OID, Name or Type), served by node indexes
+	query(std::string key, Key meaning);
+
+	/// link name matches glob `pattern` ('*' matches any sequence, '?' - any single char)
+	static auto name_glob(std::string pattern) -> query;
+	/// all bits of `mask` are set in link flags
+	static auto flags(Flags mask) -> query;
+	/// status of given request equals to `status`
+	static auto status(Req request, ReqStatus status) -> query;
+	/// arbitrary check of link
+	static auto link_pred(link_pred_f f) -> query;
+	/// arbitrary check of pointee object, links with empty or not loaded lazy data don't match
+	/// [NOTE] always evaluated last inside conjunction, because requires pulling object
+	static auto obj_pred(obj_pred_f f) -> query;
+
+	friend BS_API auto operator&&(const query& lhs, const query& rhs) -> query;
+	friend BS_API auto operator||(const query& lhs, const query& rhs) -> query;
+	friend BS_API auto operator!(const query& q) -> query;
+
+	/// check if link matches query, `opts` control if lazy links data can be pulled
+	auto match(const link& L, TreeOpts opts = def_deref_opts) const -> bool;
+
+	/// select candidates among leafs of `N` using node indexes and check them with `match()`
+	auto match(const node& N, TreeOpts opts = def_deref_opts) const -> links_v;
+
+	struct expr;
+	using sp_expr = std::shared_ptr<const expr>;
+
+private:
+	sp_expr expr_;
+
+	query(sp_expr e);
+};
+
+/// collect all links inside subtree of `root` (excluding root itself) that match `q`
+/// nodes are evaluated in parallel by `n_workers` threads (0 = hardware concurrency)
+BS_API auto search(
+	link root, const query& q, TreeOpts opts = def_walk_opts, std::size_t n_workers = 0
+) -> links_v;
+
+/// streaming search: matches are delivered to `f` as `(node, matched leafs)` chunks
+/// from background as soon as every node is evaluated, `f` calls are serialized
+/// returning `false` from `f` stops the search, at the end `f` is invoked with nil node and empty batch
+BS_API auto search(
+	launch_async_t, link root, query q, walk_batch_f f,
+	TreeOpts opts = def_walk_opts, std::size_t n_workers = 0
+) -> void;
+
+NAMESPACE_END(blue_sky::tree)
@@ -39,6 +39,32 @@ BS_API auto find_root(node N) -> node;
 BS_API auto find_root_handle(link L) -> link;
 BS_API auto find_root_handle(node N) -> link;
 
+/// path that is split into elements once and then can be dereferenced many times
+/// for paths of link IDs IDs are also parsed in advance
+class BS_API compiled_path {
+public:
+	explicit compiled_path(std::string path = {}, Key path_unit = Key::ID);
+
+	/// source path string
+	auto str() const -> const std::string& { return path_; }
+	auto path_unit() const -> Key { return path_unit_; }
+
+	/// path elements, absolute path starts with empty element
+	auto parts() const -> const std::vector<std::string>& { return parts_; }
+	auto is_absolute() const -> bool { return !parts_.empty() && parts_[0].empty(); }
+	/// true if path contains no control elements ('.', '..', empty parts except leading one)
+	auto is_plain() const -> bool { return is_plain_; }
+	/// parsed IDs (without leading empty element), non-empty only for plain path of IDs
+	auto lids() const -> const lids_v& { return lids_; }
+
+private:
+	std::string path_;
+	std::vector<std::string> parts_;
+	lids_v lids_;
+	Key path_unit_;
+	bool is_plain_;
+};
+
 /// convert path one path representaion to another
 BS_API auto convert_path(
 	std::string src_path, link start,
@@ -59,12 +85,25 @@ BS_API link deref_path(
 	TreeOpts opts = def_deref_opts
 );
 
+/// dereference precompiled path, absolute paths are resolved via bounded cache
+/// [NOTE] cache capacity is configured by "tree.path_cache_capacity" key, 0 disables cache
+BS_API link deref_path(const compiled_path& path, link start, TreeOpts opts = def_deref_opts);
+BS_API link deref_path(const compiled_path& path, node start, TreeOpts opts = def_deref_opts);
+
 /// walk the tree just like the Python's `os.walk` is implemented
 using walk_links_fv = function_view<void (link, std::list<link>&, std::vector<link>&)>;
 BS_API void walk(
 	link root, walk_links_fv step_f, TreeOpts opts = def_walk_opts
 );
 
+/// parallel walk: sibling subtrees are expanded concurrently by work-stealing pool of
+/// `n_workers` threads (0 = hardware concurrency), `step_f` receives same args as in `walk()` above
+/// if `serial_steps` is true, `step_f` calls are serialized through calling thread,
+/// otherwise `step_f` is invoked directly from worker threads and must be thread-safe
+BS_API void walk(
+	link root, walk_links_fv step_f, TreeOpts opts, bool serial_steps, std::size_t n_workers = 0
+);
+
 /// alt walk implementation
 using walk_nodes_fv = function_view<void (node, std::list<node>&, std::vector<link>&)>;
 BS_API void walk(
@@ -82,6 +121,24 @@ BS_API auto deref_path(
 	std::string path, link start, Key path_unit = Key::ID, TreeOpts opts = def_deref_opts
 ) -> void;
 
+/// streaming walk: subtree of `root` is visited depth-first in background and leafs of every node
+/// are delivered to `f` as `(node, leafs batch)` chunks of at most `batch_size` leafs
+/// next chunk is read only after `f` returns (backpressure), returning `false` stops the walk
+/// when walk ends `f` is invoked with nil node and empty batch
+using walk_batch_f = std::function<bool(node, links_v)>;
+
+BS_API auto walk(
+	launch_async_t, link root, walk_batch_f f,
+	std::size_t batch_size = 1024, TreeOpts opts = def_walk_opts
+) -> void;
+
+/// same as above, but chunks are sent to `consumer` actor as `(a_apply, node, links_v)` requests
+/// next chunk is sent after consumer replies with `bool` (`false` stops the walk)
+BS_API auto walk(
+	launch_async_t, link root, caf::actor consumer,
+	std::size_t batch_size = 1024, TreeOpts opts = def_walk_opts
+) -> void;
+
 /*-----------------------------------------------------------------------------
  *  Walk up the tree by jumping over owners
  *-----------------------------------------------------------------------------*/
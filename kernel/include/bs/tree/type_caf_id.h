@@ -30,6 +30,7 @@ CAF_BEGIN_TYPE_ID_BLOCK(bs_tree, blue_sky::detail::bs_tree_cid_begin)
 	CAF_ADD_TYPE_ID(bs_tree, (blue_sky::tree::node))
 	CAF_ADD_TYPE_ID(bs_tree, (blue_sky::tree::node::existing_index))
 	CAF_ADD_TYPE_ID(bs_tree, (blue_sky::tree::node::insert_status))
+	CAF_ADD_TYPE_ID(bs_tree, (blue_sky::tree::node::subtree_stats))
 
 	CAF_ADD_TYPE_ID(bs_tree, (blue_sky::tree::obj_or_errbox))
 	CAF_ADD_TYPE_ID(bs_tree, (blue_sky::tree::link_or_errbox))
@@ -40,3 +41,4 @@ CAF_BEGIN_TYPE_ID_BLOCK(bs_tree, blue_sky::detail::bs_tree_cid_begin)
 CAF_END_TYPE_ID_BLOCK(bs_tree)
 
 CAF_ALLOW_UNSAFE_MESSAGE_TYPE(blue_sky::tree::event)
+CAF_ALLOW_UNSAFE_MESSAGE_TYPE(blue_sky::tree::node::subtree_stats)
@@ -28,6 +28,25 @@ auto config() -> const caf::settings& {
 	return KIMPL.get_config()->confdata_;
 }
 
+auto set(std::string_view key, std::optional<caf::config_value> value)
+-> std::optional<caf::config_value> {
+	auto& confdata = KIMPL.get_config()->confdata_;
+	auto res = std::optional<caf::config_value>{};
+	if(auto prev = caf::get_if(&confdata, key))
+		res = *prev;
+
+	if(value)
+		caf::put(confdata, key, std::move(*value));
+	else if(res) {
+		// erase variable from it's section
+		if(const auto dot = key.rfind('.'); dot == std::string_view::npos)
+			confdata.erase(std::string{key});
+		else
+			caf::put_dictionary(confdata, key.substr(0, dot)).erase(std::string{key.substr(dot + 1)});
+	}
+	return res;
+}
+
 auto config_section(std::string_view name) -> caf::config_option_adder {
 	return caf::config_option_adder(KIMPL.get_config()->confopt_, name);
 }
@@ -14,6 +14,63 @@
 #define KRADIO ::blue_sky::singleton<::blue_sky::kernel::detail::radio_subsyst>::Instance()
 
 NAMESPACE_BEGIN(blue_sky::kernel::radio)
+NAMESPACE_BEGIN()
+
+thread_local bool is_interactive_ = false;
+
+// blocking actor reused by thread for synchronous requests
+struct pooled_caller {
+	std::unique_ptr<caf::scoped_actor> self;
+	std::uint64_t epoch = 0;
+	bool busy = false;
+
+	~pooled_caller() {
+		// actor can't be cleaned up if actor system is already destroyed, leak it
+		if(self && epoch != detail::radio_subsyst::system_epoch)
+			self.release();
+	}
+};
+
+thread_local auto caller_ = pooled_caller{};
+
+NAMESPACE_END()
+
+blocking_caller::blocking_caller() {
+	if(caller_.busy) {
+		own_ = std::make_unique<caf::scoped_actor>(system());
+		self_ = own_.get();
+		return;
+	}
+
+	// drop actor that belongs to actor system that was shut down
+	const auto epoch = detail::radio_subsyst::system_epoch.load();
+	if(caller_.self && caller_.epoch != epoch)
+		caller_.self.release();
+	if(!caller_.self) {
+		caller_.self = std::make_unique<caf::scoped_actor>(system());
+		caller_.epoch = epoch;
+	}
+	caller_.busy = true;
+	self_ = caller_.self.get();
+}
+
+blocking_caller::~blocking_caller() {
+	if(own_) return;
+	caller_.busy = false;
+	if(discard_) caller_.self.reset();
+}
+
+interactive_scope::interactive_scope(bool on) : prev_(is_interactive_) {
+	is_interactive_ = prev_ || on;
+}
+
+interactive_scope::~interactive_scope() {
+	is_interactive_ = prev_;
+}
+
+auto is_interactive() -> bool {
+	return is_interactive_;
+}
 
 auto system() -> caf::actor_system& {
 	return KRADIO.system();
@@ -31,6 +88,10 @@ auto toggle(bool on) -> void {
 	KRADIO.toggle(on);
 }
 
+auto restart_link_shards() -> void {
+	KRADIO.restart_link_shards();
+}
+
 auto start_server() -> void {
 	KRADIO.start_server();
 }
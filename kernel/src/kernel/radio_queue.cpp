@@ -6,12 +6,16 @@
 /// You can obtain one at https://mozilla.org/MPL/2.0/
 
 #include "radio_subsyst.h"
+#include "../tree/shard_executor.h"
 
 #include <bs/actor_common.h>
+#include <bs/kernel/config.h>
 #include <bs/kernel/radio.h>
 
 #include <caf/typed_event_based_actor.hpp>
 
+#include <algorithm>
+
 NAMESPACE_BEGIN(blue_sky::kernel::detail)
 NAMESPACE_BEGIN()
 
@@ -37,63 +41,107 @@ NAMESPACE_END()
 //  queue management
 //
 auto radio_subsyst::spawn_queue() -> void {
-	// we can save thread ID, because detached actors run in their own thread
-	queue_ = actor_sys_->spawn<caf::detached>(kqueue_processor);
+	const auto n_lanes = std::max<std::size_t>(
+		get_or(config::config(), "radio.queue_lanes", std::uint32_t{1}), 1
+	);
 	// [NOTE] need to explicitly supply scoped_actor because radio init is not yet finished
 	auto r = caf::scoped_actor{*actor_sys_};
-	actorf<std::thread::id>(r, queue_, kernel::radio::timeout(), a_ack_v)
-	.map([this](std::thread::id tid) { queue_tid_ = std::move(tid); })
-	.map_error([](const error& er) { throw er; });
+	queues_.clear();
+	queue_tids_.clear();
+	for(std::size_t i = 0; i < n_lanes; ++i) {
+		// we can save thread ID, because detached actors run in their own thread
+		auto& Q = queues_.emplace_back(actor_sys_->spawn<caf::detached>(kqueue_processor));
+		actorf<std::thread::id>(r, Q, kernel::radio::timeout(), a_ack_v)
+		.map([this](std::thread::id tid) { queue_tids_.push_back(std::move(tid)); })
+		.map_error([](const error& er) { throw er; });
+	}
 }
 
 auto radio_subsyst::stop_queue(bool wait_exit) -> void {
-	if(!queue_) return;
 	auto self = caf::scoped_actor{system(), false};
-	self->send_exit(queue_, caf::exit_reason::user_shutdown);
-	if(wait_exit)
-		self->wait_for(queue_);
-	// [NOTE} need to explicitly reset queue handle, otherwise exit hangs
-	// [TODO] check if this bug present in CAF 0.18
-	queue_ = nullptr;
+	for(auto& Q : queues_) {
+		if(!Q) continue;
+		self->send_exit(Q, caf::exit_reason::user_shutdown);
+		if(wait_exit)
+			self->wait_for(Q);
+		// [NOTE} need to explicitly reset queue handle, otherwise exit hangs
+		// [TODO] check if this bug present in CAF 0.18
+		Q = nullptr;
+	}
+}
+
+auto radio_subsyst::queue_lanes() const -> std::size_t {
+	return queues_.size();
 }
 
 auto radio_subsyst::is_queue_thread() const -> bool {
-	return std::this_thread::get_id() == queue_tid_;
+	return std::find(queue_tids_.begin(), queue_tids_.end(), std::this_thread::get_id())
+		!= queue_tids_.end();
+}
+
+auto radio_subsyst::queue_actor(queue_key key) const -> kqueue_actor_type {
+	return queues_.empty() ? kqueue_actor_type{} : queues_[key % queues_.size()];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  link shards
+//
+auto radio_subsyst::spawn_link_shards() -> void {
+	const auto n_shards = get_or(config::config(), "tree.link_shards", std::uint32_t{0});
+	link_shards_.clear();
+	for(std::uint32_t i = 0; i < n_shards; ++i)
+		link_shards_.push_back(tree::detail::spawn_link_shard(*actor_sys_));
+}
+
+auto radio_subsyst::stop_link_shards() -> void {
+	auto self = caf::scoped_actor{system(), false};
+	for(const auto& S : link_shards_)
+		self->send_exit(S, caf::exit_reason::user_shutdown);
+	// [NOTE] drop handles, so no transactions are sent to dead shards
+	link_shards_.clear();
+}
+
+auto radio_subsyst::restart_link_shards() -> void {
+	if(!actor_sys_) return;
+	stop_link_shards();
+	spawn_link_shards();
+}
+
+auto radio_subsyst::link_shard(std::size_t key) const -> caf::actor {
+	return link_shards_.empty() ? caf::actor{} : link_shards_[key % link_shards_.size()];
 }
 
-auto radio_subsyst::queue_actor(bool force_anon) -> kqueue_actor_type {
-	// if called from main queue thread (tr is started from within another running tr)
-	// then return temp spawned non-detached actor (anon queue)
-	return force_anon || std::this_thread::get_id() == queue_tid_ ?
-		actor_sys_->spawn<caf::lazy_init>(kqueue_processor) :
-		queue_
-	;
+auto radio_subsyst::link_shards() const -> std::size_t {
+	return link_shards_.size();
 }
 
-// async tr can always be executed in main queue
-auto radio_subsyst::enqueue(launch_async_t, transaction tr) -> void {
-	caf::anon_send(queue_, std::move(tr));
+// async tr can always be executed in queue
+auto radio_subsyst::enqueue(launch_async_t, transaction tr, queue_key key) -> void {
+	caf::anon_send(queue_actor(key), std::move(tr));
 }
 
-// sync tr must not block itself -> autospawn anon queue then
-auto radio_subsyst::enqueue(transaction tr, bool force_anon) -> tr_result {
-	// if cannot run in main queue -- eval inplace
-	if(force_anon || std::this_thread::get_id() == queue_tid_)
+// sync tr must not block itself -> eval inplace if started from within another running tr
+// [NOTE] this also applies to tr started from another lane, otherwise lanes waiting
+// for each other can deadlock
+auto radio_subsyst::enqueue(transaction tr, bool force_anon, queue_key key) -> tr_result {
+	// if cannot run in queue -- eval inplace
+	if(force_anon || is_queue_thread())
 		return tr_eval(std::move(tr));
 	else
-		return actorf<tr_result>(queue_, kernel::radio::timeout(true), std::move(tr));
+		return actorf<tr_result>(queue_actor(key), kernel::radio::timeout(true), std::move(tr));
 }
 
-auto radio_subsyst::enqueue(caf::event_based_actor* context, transaction tr, bool force_anon)
--> caf::result<tr_result::box> {
-	// if cannot run in main queue -- eval inplace
-	if(force_anon || std::this_thread::get_id() == queue_tid_)
+auto radio_subsyst::enqueue(
+	caf::event_based_actor* context, transaction tr, bool force_anon, queue_key key
+) -> caf::result<tr_result::box> {
+	// if cannot run in queue -- eval inplace
+	if(force_anon || is_queue_thread())
 		return pack(tr_eval(std::move(tr)));
 	else {
 		// [NOTE] using request.await to stop messages processing while tr is executed
 		auto res = context->make_response_promise<tr_result::box>();
 		context->request(
-			queue_, kernel::radio::timeout(true), std::move(tr)
+			queue_actor(key), kernel::radio::timeout(true), std::move(tr)
 		).await(
 			[=](tr_result::box tres) mutable { res.deliver(std::move(tres)); },
 			[=](const caf::error& er) mutable { res.deliver(pack(tr_result{ forward_caf_error(er) })); }
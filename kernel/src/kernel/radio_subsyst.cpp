@@ -104,6 +104,7 @@ auto radio_subsyst::init() -> error {
 		get_actor_sys_ = &radio_subsyst::normal_as_getter;
 
 		spawn_queue();
+		spawn_link_shards();
 	}
 	return perfect;
 }
@@ -116,6 +117,7 @@ auto radio_subsyst::shutdown() -> void {
 	reset_timeouts(1us, 1us);
 	kick_citizens();
 
+	stop_link_shards();
 	stop_queue(false);
 
 	// explicitly kill nill link
@@ -133,6 +135,7 @@ auto radio_subsyst::shutdown() -> void {
 	// destroy actor_system
 	actor_sys_->await_actors_before_shutdown(false);
 	get_actor_sys_ = &radio_subsyst::always_throw_as_getter;
+	++system_epoch;
 	actor_sys_.reset();
 	std::cout << "~~~ radio shutdown finished" << std::endl;
 }
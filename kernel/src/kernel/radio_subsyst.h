@@ -20,9 +20,12 @@
 #include <caf/scoped_actor.hpp>
 #include <caf/detail/shared_spinlock.hpp>
 
+#include <atomic>
+#include <functional>
 #include <optional>
 #include <set>
 #include <unordered_set>
+#include <vector>
 
 #define KRADIO ::blue_sky::singleton<::blue_sky::kernel::detail::radio_subsyst>::Instance()
 
@@ -46,6 +49,9 @@ struct BS_HIDDEN_API radio_subsyst {
 		return (this->*get_actor_sys_)();
 	}
 
+	// incremented when actor system is destroyed, invalidates actors pooled by threads
+	static inline std::atomic<std::uint64_t> system_epoch = 0;
+
 	// collect event-based actor adresses that must exit with kernel
 	auto register_citizen(caf::actor_addr citizen) -> void;
 	inline auto register_citizen(const caf::abstract_actor* citizen) {
@@ -61,17 +67,37 @@ struct BS_HIDDEN_API radio_subsyst {
 	// send exit message to all citizens & wait until they exit
 	auto kick_citizens() -> void;
 
+	// kernel's queue consists of lanes, transactions with same ordering key are executed
+	// in same lane one by one, transactions with different keys can run in parallel
+	// [NOTE] key 0 always maps to main lane, number of lanes is set by "radio.queue_lanes" key
+	using queue_key = std::size_t;
+
+	template<typename T>
+	static auto make_queue_key(const T& ordering_id) -> queue_key {
+		return std::hash<T>{}(ordering_id);
+	}
+
 	// eval transaction with blocking wait for result
-	auto enqueue(transaction tr, bool force_anon = false) -> tr_result;
+	auto enqueue(transaction tr, bool force_anon = false, queue_key key = 0) -> tr_result;
 	// post transaction into kernel's queue
-	auto enqueue(launch_async_t, transaction tr) -> void;
+	auto enqueue(launch_async_t, transaction tr, queue_key key = 0) -> void;
 	// use `context.request().await()` to execute tr in queue
 	// 'blocking' actor wait for result
-	auto enqueue(caf::event_based_actor* context, transaction tr, bool force_anon = false)
-		-> caf::result<tr_result::box>;
-	// check that this (calling side) thread is kernel's queue thread
+	auto enqueue(
+		caf::event_based_actor* context, transaction tr, bool force_anon = false, queue_key key = 0
+	) -> caf::result<tr_result::box>;
+	// check that this (calling side) thread is thread of any kernel's queue lane
 	auto is_queue_thread() const -> bool;
 	auto stop_queue(bool wait_exit) -> void;
+	auto queue_lanes() const -> std::size_t;
+
+	// executors of link transactions in sharded engine mode, see tree/shard_executor.h
+	// [NOTE] number of shards is set by "tree.link_shards" key, 0 (default) disables sharding
+	auto link_shard(std::size_t key) const -> caf::actor;
+	auto link_shards() const -> std::size_t;
+	auto stop_link_shards() -> void;
+	// stop running shards & spawn new ones according to current config
+	auto restart_link_shards() -> void;
 
 	// server actor management
 	auto toggle(bool on) -> error;
@@ -99,16 +125,20 @@ private:
 	citizens_registry_t citizens_;
 	caf::detail::shared_spinlock guard_;
 
-	// queue
-	kqueue_actor_type queue_;
-	std::thread::id queue_tid_;
+	// queue lanes & their threads IDs
+	std::vector<kqueue_actor_type> queues_;
+	std::vector<std::thread::id> queue_tids_;
+
+	// shard executors, respawned on every init
+	std::vector<caf::actor> link_shards_;
 
 	caf::actor radio_;
 
 	auto reset_timeouts(timespan typical, timespan slow) -> void;
 
 	auto spawn_queue() -> void;
-	auto queue_actor(bool force_anon) -> kqueue_actor_type;
+	auto spawn_link_shards() -> void;
+	auto queue_actor(queue_key key) const -> kqueue_actor_type;
 };
 
 NAMESPACE_END(blue_sky::kernel::detail)
@@ -13,6 +13,9 @@
 
 #include "../kernel/radio_subsyst.h"
 
+#include <bs/objbase.h>
+#include <bs/tree/node.h>
+
 #include <optional>
 #include <tuple>
 
@@ -26,7 +29,9 @@ auto adapt_enqueue_impl(F&& f, const identity<R (Args...)> _) {
 			[f, argtup = std::make_tuple(std::forward<Args>(args)...)]() mutable {
 				std::apply(*f, std::move(argtup));
 				return perfect;
-			}
+			},
+			// calls of same callback are ordered
+			kernel::detail::radio_subsyst::make_queue_key(static_cast<const void*>(f.get()))
 		);
 	};
 };
@@ -37,14 +42,31 @@ auto adapt_enqueue(F&& f) {
 	return adapt_enqueue_impl(std::forward<F>(f), identity< deduce_callable_t<F> >{});
 };
 
+// ordering keys of transactions applied to tree elements & objects
+inline auto queue_key(const tree::link& L) {
+	return kernel::detail::radio_subsyst::make_queue_key(L.id());
+}
+
+inline auto queue_key(const tree::node& N) {
+	return kernel::detail::radio_subsyst::make_queue_key(N.home_id());
+}
+
+inline auto queue_key(const objbase& obj) {
+	return kernel::detail::radio_subsyst::make_queue_key(obj.id());
+}
+
 // run Python transaction (applied to link/object) in kernel's queue
+// transactions with same `key` (for ex. applied to same link) are executed in order
 template<typename... Ts>
-auto adapt_py_tr(std::function< py::object(Ts...) > tr, bool launch_async) {
+auto adapt_py_tr(
+	std::function< py::object(Ts...) > tr, bool launch_async,
+	kernel::detail::radio_subsyst::queue_key key = 0
+) {
 	// If we know that calling side is going to wait for `tr` result (launch_async == false)
 	// then force running `tr` in anon queue if we're currently inside anoter transaction
 	return [
 		tr = make_result_converter<tr_result>(std::move(tr), perfect),
-		force_anon = launch_async ? false : KRADIO.is_queue_thread()
+		force_anon = launch_async ? false : KRADIO.is_queue_thread(), key
 	](caf::event_based_actor* papa, Ts... args) mutable -> caf::result<tr_result::box> {
 		return KRADIO.enqueue(
 			papa,
@@ -54,7 +76,7 @@ auto adapt_py_tr(std::function< py::object(Ts...) > tr, bool launch_async) {
 				tr.reset();
 				return r;
 			},
-			force_anon
+			force_anon, key
 		);
 	};
 }
@@ -19,6 +19,8 @@
 #include <pybind11/chrono.h>
 #include <fmt/format.h>
 
+#include <optional>
+
 PYBIND11_MAKE_OPAQUE(blue_sky::str_any_array)
 PYBIND11_MAKE_OPAQUE(blue_sky::idx_any_array)
 PYBIND11_MAKE_OPAQUE(caf::settings)
@@ -148,6 +150,17 @@ auto bind_radio(py::module& m) -> void {
 	m.def("unpublish_link", &kr::unpublish_link, nogil);
 	m.def("bye_actor", &kr::bye_actor, "actor_id"_a, "Send `a_bye` message to registered actor with given ID");
 	m.def("kick_citizens", [] { KRADIO.kick_citizens(); });
+
+	// context manager that makes blocking requests of current thread interactive
+	struct py_interactive_scope {
+		std::optional<kr::interactive_scope> scope;
+	};
+	py::class_<py_interactive_scope>(m, "interactive")
+		.def(py::init<>())
+		.def("__enter__", [](py_interactive_scope& self) { self.scope.emplace(); })
+		.def("__exit__", [](py_interactive_scope& self, const py::args&) { self.scope.reset(); })
+	;
+	m.def("is_interactive", &kr::is_interactive, "Check if requests of current thread are interactive");
 }
 
 auto bind_kernel_api(py::module& m) -> void {
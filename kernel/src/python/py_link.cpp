@@ -47,7 +47,8 @@ auto adapt(adapted_data_cb&& f) {
 				(*f)(adapt(std::move(obj), L), L);
 				f.reset();
 				return perfect;
-			}}
+			}},
+			queue_key(L)
 		);
 	};
 }
@@ -67,7 +68,9 @@ auto mapper2queue(F mf, identity<R (Args...)> _) {
 				else
 					rp.deliver( std::apply(*mf, std::move(argstup)) );
 				return perfect;
-			}
+			},
+			// calls of same mapping function are ordered
+			kernel::detail::radio_subsyst::make_queue_key(static_cast<const void*>(mf.get()))
 		);
 		return rp;
 	};
@@ -232,7 +235,7 @@ void py_bind_link(py::module& m) {
 		.def("apply",
 			[](const link& L, py_link_transaction tr) {
 				// capture Py transaction with sahred_ptr while GIL is held
-				auto piped_tr = adapt_py_tr(std::move(tr), false);
+				auto piped_tr = adapt_py_tr(std::move(tr), false, queue_key(L));
 				// release GIL & exec transaction in kernel's queue = in another thread
 				const auto g = py::gil_scoped_release{};
 				return L.apply(std::move(piped_tr));
@@ -242,7 +245,7 @@ void py_bind_link(py::module& m) {
 
 		.def("apply",
 			[](const link& L, launch_async_t, py_link_transaction tr) {
-				L.apply(launch_async, adapt_py_tr(std::move(tr), true));
+				L.apply(launch_async, adapt_py_tr(std::move(tr), true, queue_key(L)));
 			},
 			"launch_async"_a, "tr"_a, "Send transaction `tr` to link's queue, return immediately (async)"
 		)
@@ -250,7 +253,7 @@ void py_bind_link(py::module& m) {
 		.def("data_apply",
 			[](const link& L, py_obj_transaction tr) {
 				// capture Py transaction with sahred_ptr while GIL is held
-				auto piped_tr = adapt_py_tr(std::move(tr), false);
+				auto piped_tr = adapt_py_tr(std::move(tr), false, queue_key(L));
 				// release GIL & exec transaction in kernel's queue = in another thread
 				const auto g = py::gil_scoped_release{};
 				return L.data_apply(std::move(piped_tr));
@@ -260,7 +263,7 @@ void py_bind_link(py::module& m) {
 
 		.def("data_apply",
 			[](const link& L, launch_async_t, py_obj_transaction tr) {
-				L.data_apply(launch_async, adapt_py_tr(std::move(tr), true));
+				L.data_apply(launch_async, adapt_py_tr(std::move(tr), true, queue_key(L)));
 			},
 			"launch_async"_a, "tr"_a, "Send transaction `tr` to object's queue, return immediately"
 		)
@@ -269,7 +272,7 @@ void py_bind_link(py::module& m) {
 		.def("data_apply",
 			[](const link& L, py_obj_transaction tr, link::process_tr_cb f) {
 				L.data_apply(
-					adapt_py_tr(std::move(tr), true), adapt_enqueue(std::move(f))
+					adapt_py_tr(std::move(tr), true, queue_key(L)), adapt_enqueue(std::move(f))
 				);
 			},
 			"tr"_a, "f"_a,
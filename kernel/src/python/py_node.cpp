@@ -16,6 +16,8 @@
 #include <pybind11/functional.h>
 #include <pybind11/chrono.h>
 
+#include <variant>
+
 NAMESPACE_BEGIN(blue_sky::python)
 using namespace tree;
 
@@ -189,7 +191,7 @@ void py_bind_node(py::module& m) {
 		.def("size", &node_type::size, gil...)
 		.def("empty", &node_type::empty, gil...)
 
-		.def("leafs", &node_type::leafs,
+		.def("leafs", py::overload_cast<Key>(&node_type::leafs, py::const_),
 			"Key"_a = Key::AnyOrder, "Return snapshot of node content", gil...)
 
 		.def("keys", [](const node& N, Key key_meaning, Key ordering) {
@@ -312,6 +314,23 @@ void py_bind_node(py::module& m) {
 
 		.def("skeys", &node::skeys, "key_meaning"_a, "ordering"_a = Key::AnyOrder, nogil)
 
+		// paged access
+		.def("leafs", py::overload_cast<Key, std::size_t, std::size_t>(&node::leafs, py::const_),
+			"Key"_a, "offset"_a, "count"_a, "Return at most `count` leafs starting from `offset`", nogil)
+		// [NOTE] keys are returned as variant, because they're converted to Python after GIL is acquired
+		.def("keys", [](const node& N, Key key_meaning, Key ordering, std::size_t offset, std::size_t count)
+			-> std::variant<lids_v, std::vector<std::size_t>> {
+				if(key_meaning == Key::ID)
+					return N.keys(ordering, offset, count);
+				else if(key_meaning == Key::AnyOrder)
+					return N.ikeys(ordering, offset, count);
+				else
+					throw py::key_error("Only ID or AnyOrder keys can be fetched by pages");
+			}, "key_meaning"_a, "ordering"_a, "offset"_a, "count"_a,
+			"Return window of ID (or index if `key_meaning` is AnyOrder) keys sorted according to `ordering`",
+			nogil
+		)
+
 		// check if node contains key
 		// ... by object
 		.def("__contains__", &contains_obj, "obj"_a)
@@ -380,9 +399,10 @@ void py_bind_node(py::module& m) {
 			"new_order"_a, "Apply custom order to node")
 
 		// events subscrition
-		.def("subscribe", [](const node& N, node::event_handler f, Event listen_to) {
-			return N.subscribe(adapt_enqueue(std::move(f)), listen_to);
-		}, "event_cb"_a, "events"_a = Event::All)
+		.def("subscribe", [](const node& N, node::event_handler f, Event listen_to, TreeOpts opts) {
+			return N.subscribe(adapt_enqueue(std::move(f)), listen_to, {}, opts);
+		}, "event_cb"_a, "events"_a = Event::All, "opts"_a = TreeOpts::Deep,
+		"Subscribe to events of this node, pass `opts` without `Deep` flag to skip events of subtree")
 
 		.def("unsubscribe", py::overload_cast<deep_t>(&node::unsubscribe, py::const_))
 		.def("unsubscribe", py::overload_cast<>(&engine::unsubscribe, py::const_))
@@ -394,7 +414,7 @@ void py_bind_node(py::module& m) {
 		.def("apply",
 			[](const node& N, py_node_transaction tr) {
 				// capture Py transaction with sahred_ptr while GIL is held
-				auto piped_tr = adapt_py_tr(std::move(tr), false);
+				auto piped_tr = adapt_py_tr(std::move(tr), false, queue_key(N));
 				// release GIL & exec transaction in kernel's queue = in another thread
 				const auto g = py::gil_scoped_release{};
 				return N.apply(std::move(piped_tr));
@@ -404,7 +424,7 @@ void py_bind_node(py::module& m) {
 
 		.def("apply",
 			[](const node& N, launch_async_t, py_node_transaction tr) {
-				N.apply(launch_async, adapt_py_tr(std::move(tr), true));
+				N.apply(launch_async, adapt_py_tr(std::move(tr), true, queue_key(N)));
 			},
 			"launch_async"_a, "tr"_a, "Send transaction `tr` to node's queue, return immediately"
 		)
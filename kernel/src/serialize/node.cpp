@@ -54,6 +54,7 @@ struct leafs_view {
 			if(leaf)
 				any_order.insert(any_order.end(), std::move(leaf));
 		}
+		N.snapshot_reset();
 	}
 };
 
@@ -68,7 +69,7 @@ BSS_FCN_BEGIN(serialize, tree::node_impl)
 	else {
 		std::string home_id;
 		ar(make_nvp("home_id", home_id));
-		t.home = blue_sky::kernel::radio::system().groups().get_local(home_id);
+		t.reset_home(std::move(home_id));
 	}
 	// store leafs
 	ar(make_nvp("leafs", leafs_view(t)));
@@ -94,6 +95,7 @@ BSS_FCN_BEGIN(serialize, node)
 		ar(make_nvp("node", t.pimpl_));
 		if(t.pimpl_) {
 			// impl is ready, we can start internal actor
+			// [NOTE] actor is actually spawned on first access to it
 			t.start_engine();
 			// correct owner of all loaded links
 			// [NOTE] disabled, already handled by `start_engine()`
@@ -109,10 +109,15 @@ struct tree_fs_input::impl : detail::file_heads_manager<false> {
 		);
 
 		// insert loaded leafs in one transaction
-		push_error(N.apply([&](bare_node N) {
+		const auto insert_babies = [&](bare_node N) {
 			N.insert(unsafe, std::move(babies));
 			return perfect;
-		}));
+		};
+		// node being loaded isn't shared yet, so passive node is filled directly without spawning actor
+		if(N.has_actor())
+			push_error(N.apply(insert_babies));
+		else
+			push_error(error::eval_safe([&] { return insert_babies(N.bare()); }));
 
 		if(united_err_msg.empty()) return perfect;
 		else return united_err_msg;
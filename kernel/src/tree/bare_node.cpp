@@ -120,9 +120,7 @@ auto bare_node::erase(lid_type link_id) -> std::size_t {
 }
 
 auto bare_node::clear() -> std::size_t {
-	auto res = pimpl_->size();
-	pimpl_->links_.clear();
-	return res;
+	return pimpl_->clear();
 }
 
 auto bare_node::rearrange(std::vector<lid_type> new_order) -> error {
@@ -273,8 +273,32 @@ struct BS_HIDDEN_API context::impl {
 		return std::nullopt;
 	}
 
+	// cache tags for chain of links going from root down to leaf, returns leaf's index
+	auto push_chain(const links_v& Ls) -> item_index {
+		if(Ls.empty()) return none;
+		const auto& leaf = Ls.back();
+		const auto leaf_row = leaf.owner().index(leaf.id());
+		if(!leaf_row) return none;
+
+		auto cur_path = path_t{};
+		cur_path.reserve(Ls.size());
+		auto leaf_tag = existing_tag{};
+		for(const auto& L : Ls) {
+			cur_path.push_back(L.id());
+			leaf_tag = push(cur_path, L);
+		}
+		return { std::move(leaf_tag), *leaf_row };
+	}
+
 	auto make(const std::string& path, bool nonexact_match = false) -> item_index {
 		//bsout() << "*** index_from_path()" << bs_end;
+		// fast path: resolve all path items at once via links registry
+		if(path.empty() || path == "/") return none;
+		if(auto upath = to_lids_v(path)) {
+			if(auto res = push_chain(detail::deref_registered(*upath, root_)); is_valid(res))
+				return res;
+		}
+
 		auto level = root_;
 		auto res = none;
 
@@ -304,6 +328,23 @@ struct BS_HIDDEN_API context::impl {
 		const auto parent_node = L.owner();
 		if(!parent_node) return none;
 
+		// fast path: collect link's ancestors walking up to root
+		auto Ls = links_v{};
+		auto cur = L;
+		for(auto cur_parent = parent_node; cur_parent;) {
+			Ls.push_back(cur);
+			if(cur_parent == root_) {
+				std::reverse(Ls.begin(), Ls.end());
+				if(auto res = push_chain(Ls); is_valid(res))
+					return res;
+				break;
+			}
+			if(( cur = cur_parent.handle() ))
+				cur_parent = cur.owner();
+			else
+				break;
+		}
+
 		// make path hint start relative to current model root
 		auto rootp = abspath(root_lnk_, Key::ID);
 		// if path_hint.startswith(rootp)
@@ -7,7 +7,9 @@
 
 #include "node_actor.h"
 #include "node_extraidx_actor.h"
+#include "tree_impl.h"
 
+#include <bs/kernel/config.h>
 #include <bs/kernel/radio.h>
 #include <bs/detail/scope_guard.h>
 
@@ -16,6 +18,28 @@
 #include "actor_debug.h"
 
 NAMESPACE_BEGIN(blue_sky::tree::detail)
+/// max number of child subtrees searched concurrently, 1 means sequental search
+/// [NOTE] configured by "tree.deep_search_parallelism" key
+inline auto deep_search_parallelism() -> std::size_t {
+	return std::max<std::size_t>(
+		get_or(kernel::config::config(), "tree.deep_search_parallelism", std::uint32_t{1}), 1
+	);
+}
+
+/// state of child leafs fan-out shared by all branches of single deep search
+/// [NOTE] accessed only from node actor's context, so no sync is required
+struct deep_search_state {
+	// leafs waiting to be processed, taken from the back
+	links_v work;
+	// merged results of completed branches
+	links_v res;
+	// number of branches in flight
+	std::size_t running = 0;
+	// result is delivered, responses from outstanding branches are dropped
+	bool done = false;
+};
+using sp_deep_search_state = std::shared_ptr<deep_search_state>;
+
 /*-----------------------------------------------------------------------------
  *  this impl does no blocked waits and suitable for direct invoke from node actor
  *-----------------------------------------------------------------------------*/
@@ -25,60 +49,42 @@ auto deep_search_impl(
 ) -> caf::result<links_v> {
 	using namespace kernel::radio;
 
+	// link IDs are unique, so first try to resolve ID via links registry
+	if constexpr(K == Key::ID) {
+		if(auto L = find_registered(key, self->impl.super_engine())) {
+			adbg(self) << "DS: 0. found in links registry" << std::endl;
+			return links_v{std::move(L)};
+		}
+	}
+
 	// 0. prepare result promise
 	auto res_promise = self->make_response_promise<links_v>();
 
-	// 3. sequental leafs processor as recursive lambda
-	auto do_search_leafs = [=](auto&& fimpl, auto work, links_v res, lids_v asl) mutable {
-		// 1st possible outcome: end of work processing chain - deliver current result
-		if(work.empty()) {
-			adbg(self) << "DS: 3. deliver result (work is empty), res size = " << res.size() << std::endl;
-			res_promise.deliver(std::move(res));
-			return;
-		}
-
-		// cut current work
-		auto L = work.back();
-		work.pop_back();
-		adbg(self) << "DS: 3. process leaf " << L.id() << std::endl;
-
-		// 2nd possible outcome: recursion step to process remaining work
-		auto make_next_iteration =
-		[=, work = std::move(work)](links_v res) mutable {
-			return [=, res = std::move(res)]() mutable {
-				adbg(self) << "DS: 3. recursion to next step" << std::endl;
-				// invoke self with rest of work
-				fimpl(fimpl, std::move(work), std::move(res), std::move(asl));
-			};
-		};
-		// fallback next step if error is encountered on current leaf
-		auto next_step = make_next_iteration(res);
+	// 4. search in single child leaf, `on_done()` is invoked exactly once with leaf results
+	auto search_leaf = [=](const link& L, lids_v asl, auto on_done) mutable {
+		adbg(self) << "DS: 4. process leaf " << L.id() << std::endl;
 
 		// remember symlink or quit if we meet already processed links
-		const auto is_symlink = L.type_id() == sym_link::type_id_();
-		if(const auto Lid = L.id(); is_symlink) {
-			auto pos = std::lower_bound(asl.begin(), asl.begin(), Lid);
-			if(pos != asl.end()) {
-				if(*pos == Lid) {
-					// current work is already processed symlink - quit
-					next_step();
-					return;
-				}
-				else ++pos;
+		if(L.type_id() == sym_link::type_id_()) {
+			const auto Lid = L.id();
+			auto pos = std::lower_bound(asl.begin(), asl.end(), Lid);
+			if(pos != asl.end() && *pos == Lid) {
+				// current work is already processed symlink - quit
+				on_done(links_v{});
+				return;
 			}
 			asl.insert(pos, Lid);
 		}
 
-		// functor that process one child leaf
-		auto search_leaf = [=, res = std::move(res), asl = std::move(asl)]() mutable {
-			adbg(self) << "DS: 3. DataNode request to link " << L.id() << std::endl;
+		// functor that enters child node
+		auto enter_leaf = [=, asl = std::move(asl)]() mutable {
+			adbg(self) << "DS: 4. DataNode request to link " << L.id() << std::endl;
 			self->request(L.actor(), timeout(true), a_data_node{}, true)
 			.then(
-				[=, res = std::move(res), asl = std::move(asl)](const node_or_errbox& maybe_N) mutable {
-					adbg(self) << "DS: 3. nested node = " << (bool)maybe_N <<
-						", res.size = " << res.size() << std::endl;
+				[=, asl = std::move(asl)](const node_or_errbox& maybe_N) mutable {
+					adbg(self) << "DS: 4. nested node = " << (bool)maybe_N << std::endl;
 					if(!maybe_N) {
-						next_step();
+						on_done(links_v{});
 						return;
 					}
 
@@ -86,7 +92,7 @@ auto deep_search_impl(
 					// get next level results
 					[&] {
 						const node& next_n = *maybe_N;
-						adbg(self) << "DS: 3. DeepSearch request to nested node " << next_n.home_id() << std::endl;
+						adbg(self) << "DS: 4. DeepSearch request to nested node " << next_n.home_id() << std::endl;
 						if constexpr(K == Key::ID)
 							return self->request(
 								node_impl::actor(next_n), timeout(true),
@@ -98,47 +104,79 @@ auto deep_search_impl(
 								a_node_deep_search(), key, K, return_first, std::move(asl)
 							);
 					}().then(
-						[=, res = std::move(res)](const links_v& next_l) mutable {
-							adbg(self) << "DS: 3. process result of DeepSearch request, count = " <<
+						[=](links_v next_l) mutable {
+							adbg(self) << "DS: 4. process result of DeepSearch request, count = " <<
 								next_l.size() << std::endl;
-							// merge new results into existing
-							std::copy(next_l.begin(), next_l.end(), std::back_inserter(res));
-							// deliver result or jump to next step
-							if(return_first && !res.empty())
-								res_promise.deliver(links_v{res.front()});
-							else
-								make_next_iteration(std::move(res))();
+							on_done(std::move(next_l));
 						},
-						// goto next iteration on error
-						[=](const caf::error&) mutable { next_step(); }
+						// skip leaf on error
+						[=](const caf::error&) mutable { on_done(links_v{}); }
 					);
 				},
-				// goto next iteration on error
-				[=](const caf::error&) mutable { next_step(); }
+				// skip leaf on error
+				[=](const caf::error&) mutable { on_done(links_v{}); }
 			);
 		};
 
 		// check populated status before moving to next level
 		if(L.req_status(Req::DataNode) == ReqStatus::OK)
-			search_leaf();
+			enter_leaf();
 		else {
-			adbg(self) << "DS: 3. need to check flags of link " << L.id() << std::endl;
+			adbg(self) << "DS: 4. need to check flags of link " << L.id() << std::endl;
 			// we have to check L's flags to not expand lazy links
 			self->request(L.actor(), timeout(), a_lnk_flags())
 			.then(
-				[=, search_leaf = std::move(search_leaf)](Flags Lf) mutable {
+				[=, enter_leaf = std::move(enter_leaf)](Flags Lf) mutable {
 					// don't enter lazy load links
 					if(Lf & LazyLoad)
-						next_step();
+						on_done(links_v{});
 					else
-						search_leaf();
+						enter_leaf();
 				},
-				// goto next iteration on error
-				[=](const caf::error&) mutable { next_step(); }
+				// skip leaf on error
+				[=](const caf::error&) mutable { on_done(links_v{}); }
 			);
 		}
 	};
 
+	// 3. fan-out leafs processor: keeps up to `max_running` branches in flight
+	// [NOTE] with `max_running == 1` leafs are searched sequentally in AnyOrder
+	auto do_search_leafs = [=, max_running = deep_search_parallelism()](
+		auto&& fimpl, const sp_deep_search_state& S, const lids_v& asl
+	) mutable -> void {
+		// 1st possible outcome: no more work and all branches completed - deliver current result
+		if(S->work.empty() && !S->running) {
+			adbg(self) << "DS: 3. deliver result (work is empty), res size = " << S->res.size() << std::endl;
+			S->done = true;
+			res_promise.deliver(std::move(S->res));
+			return;
+		}
+
+		// 2nd possible outcome: launch next branches
+		while(!S->done && !S->work.empty() && S->running < max_running) {
+			auto L = std::move(S->work.back());
+			S->work.pop_back();
+			++S->running;
+			search_leaf(L, asl, [=](links_v next_l) mutable {
+				--S->running;
+				// outstanding branch of already finished search - drop results
+				if(S->done) return;
+				// merge new results into existing
+				std::move(next_l.begin(), next_l.end(), std::back_inserter(S->res));
+				// deliver result and cancel remaining branches
+				if(return_first && !S->res.empty()) {
+					adbg(self) << "DS: 3. deliver first result, branches cancelled = " <<
+						S->running << std::endl;
+					S->done = true;
+					S->work.clear();
+					res_promise.deliver(links_v{S->res.front()});
+				}
+				else
+					fimpl(fimpl, S, asl);
+			});
+		}
+	};
+
 	// 2. starts leafs processing after local search is done
 	auto do_deep_search =
 	[=, do_search_leafs = std::move(do_search_leafs), asl = std::move(active_symlinks)](links_v res) mutable {
@@ -148,11 +186,13 @@ auto deep_search_impl(
 			return;
 		}
 
-		// get reverted leafs list because `do_search_leaf()` eats work from the back
-		auto Ls = self->impl.values<Key::AnyOrder>();
-		std::reverse(Ls.begin(), Ls.end());
-		adbg(self) << "DS: 2. search in children, count = " << Ls.size() << std::endl;
-		do_search_leafs(do_search_leafs, std::move(Ls), std::move(res), std::move(asl));
+		// get reverted leafs list because `do_search_leafs()` eats work from the back
+		auto S = std::make_shared<deep_search_state>();
+		S->work = self->impl.values<Key::AnyOrder>();
+		std::reverse(S->work.begin(), S->work.end());
+		S->res = std::move(res);
+		adbg(self) << "DS: 2. search in children, count = " << S->work.size() << std::endl;
+		do_search_leafs(do_search_leafs, S, asl);
 	};
 
 	// 1. do direct search in leafs
@@ -160,9 +200,14 @@ auto deep_search_impl(
 		adbg(self) << "DS: 1. direct search in builtin index" << std::endl;
 		do_deep_search(self->impl.equal_range<K>(key).extract_values());
 	}
+	else if(self->impl.has_index(K)) {
+		adbg(self) << "DS: 1. direct search in extra index" << std::endl;
+		do_deep_search(self->impl.equal_range(key, K));
+	}
 	else {
 		adbg(self) << "DS: 1. direct search in non-builtin index" << std::endl;
 		// for non-builtin indices do 'equal range' request, then proceed
+		self->extraidx_demand();
 		self->request(
 			self->spawn(extraidx_search_actor), caf::infinite,
 			a_node_equal_range(), key, K, self->impl.values<Key::AnyOrder>()
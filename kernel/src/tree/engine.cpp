@@ -9,10 +9,13 @@
 
 #include <bs/tree/engine.h>
 #include "engine_impl.h"
+#include "ev_queue.h"
 
 #include <caf/send.hpp>
 
+#include <atomic>
 #include <memory_resource>
+#include <mutex>
 
 NAMESPACE_BEGIN(blue_sky::tree)
 /*-----------------------------------------------------------------------------
@@ -69,14 +72,41 @@ auto engine::weak_ptr_base::operator!=(const engine& rhs) const -> bool {
 //  actor_handle
 //
 struct engine::actor_handle {
-	caf::actor core_;
+	// if set, spawns wrapped actor on first access
+	std::function<caf::actor()> starter_;
 
-	actor_handle(caf::actor core) : core_(std::move(core)) {}
+	actor_handle(caf::actor core) : started_(true), core_(std::move(core)) {}
+
+	actor_handle(std::function<caf::actor()> starter) :
+		starter_(std::move(starter)), started_(false)
+	{}
 
 	// destructor of actor handle terminates wrapped actor
 	~actor_handle() {
-		caf::anon_send_exit(core_, caf::exit_reason::user_shutdown);
+		if(started_)
+			caf::anon_send_exit(core_, caf::exit_reason::user_shutdown);
+	}
+
+	auto started() const -> bool {
+		return started_.load(std::memory_order_acquire);
 	}
+
+	auto core() const -> const caf::actor& {
+		// actor must be spawned only once
+		if(!started())
+			std::call_once(start_flag_, [&] {
+				core_ = starter_();
+				// release resources captured by starter
+				starter_ = nullptr;
+				started_.store(true, std::memory_order_release);
+			});
+		return core_;
+	}
+
+private:
+	mutable std::once_flag start_flag_;
+	mutable std::atomic<bool> started_;
+	mutable caf::actor core_;
 };
 
 // setup synchronized pool allocator for actor handles
@@ -111,14 +141,22 @@ auto engine::has_engine() const noexcept -> bool {
 	return pimpl_ && actor_;
 }
 
-auto engine::raw_actor() const noexcept -> const caf::actor& {
-	return actor_->core_;
+auto engine::has_actor() const noexcept -> bool {
+	return actor_->started();
+}
+
+auto engine::raw_actor() const -> const caf::actor& {
+	return actor_->core();
 }
 
 auto engine::install_raw_actor(caf::actor engine_actor) -> void {
 	actor_ = std::make_shared<actor_handle>(std::move(engine_actor));
 }
 
+auto engine::install_lazy_actor(std::function<caf::actor()> starter) -> void {
+	actor_ = std::allocate_shared<actor_handle>(ahdl_alloc, std::move(starter));
+}
+
 auto engine::hash() const noexcept -> std::size_t {
 	return std::hash<engine::sp_engine_impl>{}(pimpl_);
 }
@@ -133,11 +171,11 @@ auto engine::type_id() const -> std::string_view {
 	return pimpl_->type_id();
 }
 
-auto engine::home() const -> const caf::group& {
-	return pimpl_->home;
+auto engine::home() const -> caf::group {
+	return pimpl_->home();
 }
 
-auto engine::home_id() const -> std::string_view {
+auto engine::home_id() const -> std::string {
 	return pimpl_->home_id();
 }
 
@@ -145,8 +183,16 @@ auto engine::unsubscribe(std::uint64_t event_cb_id) -> void {
 	kernel::radio::bye_actor(event_cb_id);
 }
 
+auto engine::subscriber_stats(std::uint64_t event_cb_id) -> event_queue_stats {
+	if(auto Q = event_queue::find(event_cb_id))
+		return Q->stats();
+	return {};
+}
+
 auto engine::unsubscribe() const -> void {
-	caf::anon_send(home(), a_bye{});
+	// home group is created by first subscriber
+	if(const auto home = pimpl_->existing_home())
+		caf::anon_send(home, a_bye{});
 }
 
 NAMESPACE_END(blue_sky::tree)
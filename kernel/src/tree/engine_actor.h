@@ -17,7 +17,7 @@ struct BS_HIDDEN_API engine_actor_base : public caf::event_based_actor {
 	using super = caf::event_based_actor;
 	using sp_engine_impl = engine::sp_engine_impl;
 
-	engine_actor_base(caf::actor_config& cfg, caf::group home, sp_engine_impl Eimpl);
+	engine_actor_base(caf::actor_config& cfg, sp_engine_impl Eimpl);
 
 	auto goodbye() -> void;
 
@@ -35,8 +35,8 @@ struct engine_actor : public engine_actor_base {
 	using actor_type = typename engine_impl::actor_type;
 	using typed_behavior = typename actor_type::behavior_type;
 
-	engine_actor(caf::actor_config& cfg, caf::group home, std::shared_ptr<engine_impl> Eimpl) :
-		super(cfg, std::move(home), std::move(Eimpl)), impl([&]() -> auto& {
+	engine_actor(caf::actor_config& cfg, std::shared_ptr<engine_impl> Eimpl) :
+		super(cfg, std::move(Eimpl)), impl([&]() -> auto& {
 			return static_cast<engine_impl&>(*pimpl_);
 		}())
 	{}
@@ -14,12 +14,18 @@
 #include "../kernel/radio_subsyst.h"
 
 #include <bs/kernel/radio.h>
+#include <bs/uuid.h>
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
 
 #define DEBUG_ACTOR 0
 #include "actor_debug.h"
 
 NAMESPACE_BEGIN(blue_sky::tree)
 namespace kradio = kernel::radio;
+using namespace allow_enumops;
 
 [[maybe_unused]] auto adbg_impl(engine_actor_base* A) -> caf::actor_ostream {
 	auto os = caf::aout(A);
@@ -72,27 +78,121 @@ auto event::origin_object() const -> sp_obj {
 /*-----------------------------------------------------------------------------
  *  engine_impl
  *-----------------------------------------------------------------------------*/
-auto engine::impl::home_id() const -> std::string_view {
-	return home ? home.get()->identifier() : std::string_view{};
+auto engine::impl::make_home_id() const -> std::string {
+	return to_string(gen_uuid());
+}
+
+auto engine::impl::home_id() const -> std::string {
+	// fast path - ID is already generated
+	{
+		auto guard = std::shared_lock{home_guard_};
+		if(!home_id_.empty()) return home_id_;
+	}
+	auto guard = std::unique_lock{home_guard_};
+	if(home_id_.empty())
+		home_id_ = make_home_id();
+	return home_id_;
+}
+
+auto engine::impl::home() const -> caf::group {
+	{
+		auto guard = std::shared_lock{home_guard_};
+		if(home_) return home_;
+	}
+	// [NOTE] obtain ID before taking unique lock
+	const auto hid = home_id();
+	auto guard = std::unique_lock{home_guard_};
+	// ID could be reset while lock was released
+	if(!home_)
+		home_ = kradio::system().groups().get_local(home_id_.empty() ? hid : home_id_);
+	return home_;
+}
+
+auto engine::impl::existing_home() const -> caf::group {
+	auto guard = std::shared_lock{home_guard_};
+	return home_;
+}
+
+auto engine::impl::reset_home(std::string home_id) -> void {
+	auto guard = std::unique_lock{home_guard_};
+	home_id_ = std::move(home_id);
+	home_ = {};
 }
 
 auto engine::impl::swap(impl& rhs) -> void {
 	using std::swap;
-	swap(home, rhs.home);
+	auto guard = std::scoped_lock{home_guard_, rhs.home_guard_};
+	swap(home_, rhs.home_);
+	swap(home_id_, rhs.home_id_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  listeners
+//
+NAMESPACE_BEGIN()
+
+std::atomic<std::uint64_t> listeners_epoch_ = 0;
+
+NAMESPACE_END()
+
+auto engine::impl::listeners_epoch() -> std::uint64_t {
+	return listeners_epoch_.load();
+}
+
+auto engine::impl::listen(std::uint64_t listener_id, Event mask, bool deep) -> void {
+	auto guard = std::unique_lock{home_guard_};
+	// repeated registration extends existing one
+	const auto pos = std::find_if(listeners_.begin(), listeners_.end(), [&](const auto& l) {
+		return l.id == listener_id;
+	});
+	if(pos == listeners_.end())
+		listeners_.push_back({listener_id, mask, deep});
+	else {
+		pos->mask |= mask;
+		pos->deep = pos->deep || deep;
+		// deep flag applies to whole mask
+		if(pos->deep) deep_listen_mask_ |= enumval(pos->mask);
+	}
+	listen_mask_ |= enumval(mask);
+	if(deep) deep_listen_mask_ |= enumval(mask);
+	++listeners_epoch_;
+}
+
+auto engine::impl::unlisten(std::uint64_t listener_id) -> void {
+	auto guard = std::unique_lock{home_guard_};
+	const auto pos = std::find_if(listeners_.begin(), listeners_.end(), [&](const auto& l) {
+		return l.id == listener_id;
+	});
+	if(pos == listeners_.end()) return;
+	listeners_.erase(pos);
+
+	// recalc masks
+	auto mask = Event::Nil, deep_mask = Event::Nil;
+	for(const auto& l : listeners_) {
+		mask |= l.mask;
+		if(l.deep) deep_mask |= l.mask;
+	}
+	listen_mask_ = enumval(mask);
+	deep_listen_mask_ = enumval(deep_mask);
+	++listeners_epoch_;
+}
+
+auto engine::impl::home_listens(Event ev, bool deep) const -> bool {
+	return (deep ? deep_listen_mask_ : listen_mask_).load(std::memory_order_relaxed) & enumval(ev);
+}
+
+auto engine::impl::deep_listen_mask() const -> Event {
+	return Event(deep_listen_mask_.load(std::memory_order_relaxed));
 }
 
 /*-----------------------------------------------------------------------------
  *  engine_actor
  *-----------------------------------------------------------------------------*/
-engine_actor_base::engine_actor_base(caf::actor_config& cfg, caf::group egrp, sp_engine_impl Eimpl) :
+engine_actor_base::engine_actor_base(caf::actor_config& cfg, sp_engine_impl Eimpl) :
 	super(cfg), pimpl_(std::move(Eimpl))
 {
 	// sanity
 	if(!pimpl_) throw error{"engine actor: bad (null) impl passed"};
-	// remember link's local group
-	pimpl_->home = std::move(egrp);
-	if(pimpl_->home)
-		adbg(this) << "joined self group" << std::endl;
 
 	// exit after kernel
 	KRADIO.register_citizen(this);
@@ -116,13 +216,9 @@ engine_actor_base::engine_actor_base(caf::actor_config& cfg, caf::group egrp, sp
 
 auto engine_actor_base::goodbye() -> void {
 	adbg(this) << "goodbye" << std::endl;
-	auto& home = pimpl_->home;
-	if(home) {
-		// say goodbye to self group
+	// say goodbye to self group if anyone joined it
+	if(auto home = pimpl_->existing_home())
 		send(home, a_bye());
-		leave(home);
-		adbg(this) << "left self group" << std::endl;
-	}
 }
 
 auto engine_actor_base::on_exit() -> void {
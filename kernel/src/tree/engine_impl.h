@@ -11,12 +11,15 @@
 #include <bs/actor_common.h>
 #include <bs/tree/engine.h>
 #include <bs/tree/type_caf_id.h>
+#include <bs/detail/enumops.h>
 #include <bs/detail/sharded_mutex.h>
 
 #include <caf/detail/shared_spinlock.hpp>
 #include <caf/group.hpp>
 
+#include <atomic>
 #include <unordered_map>
+#include <vector>
 
 // helper macro to inject engine type ids
 #define ENGINE_TYPE_DECL                           \
@@ -77,14 +80,71 @@ public:
 	using sp_engine_impl = std::shared_ptr<impl>;
 	using sp_scoped_actor = std::shared_ptr<caf::scoped_actor>;
 
-	/// engine home group
-	caf::group home;
+	/// get engine's home group, group is created on first call
+	/// [NOTE] engine's actor isn't a member of home group, home messages are delivered to it directly
+	/// [NOTE] group & ID are returned by value, because they can be reset concurrently
+	auto home() const -> caf::group;
+	/// get home group only if it's already created by subscriber or parent retranslator
+	auto existing_home() const -> caf::group;
 
-	/// get engine's home group ID (empty for invalid / not started home)
-	auto home_id() const -> std::string_view;
+	/// get engine's home group ID, generated on first call if wasn't set explicitly
+	auto home_id() const -> std::string;
+	/// set ID of engine's home group, group itself will be created on demand
+	auto reset_home(std::string home_id) -> void;
 
 	auto swap(impl& rhs) -> void;
 
+	///////////////////////////////////////////////////////////////////////////////
+	//  listeners of home group
+	//
+	/// register listener of events `mask`, `deep` listener also receives events from subtree
+	/// [NOTE] acks that nobody listens to aren't broadcasted to home group
+	auto listen(std::uint64_t listener_id, Event mask, bool deep = true) -> void;
+	/// remove listener registration
+	auto unlisten(std::uint64_t listener_id) -> void;
+
+	/// check if any listener wants event `ev` (that comes from subtree if `deep` is set)
+	auto home_listens(Event ev, bool deep = false) const -> bool;
+	/// union of events masks of deep listeners
+	auto deep_listen_mask() const -> Event;
+
+	/// incremented on every listeners registration change
+	static auto listeners_epoch() -> std::uint64_t;
+
+	/// register `listener` actor with home of `H`, registration is removed when listener exits
+	template<typename Handle, typename = if_engine_handle<Handle>>
+	static auto register_listener(
+		const Handle& H, caf::abstract_actor* listener, Event mask, bool deep = true
+	) -> void {
+		pimpl(H).listen(listener->id(), mask, deep);
+		listener->attach_functor([wH = typename Handle::weak_ptr(H), lid = listener->id()] {
+			if(const auto H = wH.lock()) pimpl(H).unlisten(lid);
+		});
+	}
+
+	/// event code that ack message produces for listeners, `Nil` for service acks
+	template<typename... Ts>
+	static constexpr auto ack_event() -> Event {
+		if constexpr(has_atom_v<a_lnk_rename, Ts...>) return Event::LinkRenamed;
+		else if constexpr(has_atom_v<a_lnk_status, Ts...>) return Event::LinkStatusChanged;
+		else if constexpr(has_atom_v<a_node_insert, Ts...>) return Event::LinkInserted;
+		else if constexpr(has_atom_v<a_node_erase, Ts...>) return Event::LinkErased;
+		else if constexpr(has_atom_v<a_data, Ts...>) return Event::DataModified;
+		else return Event::Nil;
+	}
+
+	/// check if ack sent by `src` is retranslated from subtree (contains origin actor != `src`)
+	template<typename Src, typename T1, typename T2, typename... Ts>
+	static auto ack_is_deep(const Src& src, const T1&, const T2& origin, const Ts&...) -> bool {
+		if constexpr(std::is_same_v<T2, caf::actor>)
+			return origin != caf::actor_cast<caf::actor>(src);
+		else
+			return false;
+	}
+
+	template<typename Src, typename... Ts>
+	static auto ack_is_deep(const Src&, const Ts&...) -> bool { return false; }
+
 	// required, `engine` holds a pointer to `impl`
 	virtual ~impl() = default;
 
@@ -125,22 +185,70 @@ public:
 	}
 
 	/// send message to home group with compile-time check against home actor type
+	/// [NOTE] message is broadcasted only if home group has been created and has interested listeners
 	template<
 		caf::message_priority P = caf::message_priority::normal, typename ActorClass, typename... Ts
 	>
 	static auto send_home(ActorClass* src, Ts&&... xs) -> void {
 		using home_actor_t = typename engine_impl_t<decltype(src->impl)>::home_actor_type;
-		checked_send<home_actor_t, P>(*src, src->impl.home, std::forward<Ts>(xs)...);
+		checked_send<home_actor_t, P>(*src, caf::actor_cast<caf::actor>(src), xs...);
+		if(const auto home = src->impl.existing_home(); home && src->impl.home_listens(
+			ack_event<Ts...>(), ack_is_deep(src, xs...)
+		))
+			checked_send<home_actor_t, P>(*src, home, std::forward<Ts>(xs)...);
 	}
 
 	/// same as above but accepts Handle (or it's impl) instead of engine actor
+	/// [NOTE] not yet started engine's actor is skipped
 	template<
 		caf::message_priority P = caf::message_priority::normal, typename Handle, typename... Ts
 	>
 	static auto send_home(const Handle& H, Ts&&... xs) -> void {
 		using home_actor_t = typename engine_impl_t<Handle>::home_actor_type;
-		checked_send<home_actor_t, P>(pimpl(H).home, std::forward<Ts>(xs)...);
+		auto src = blue_sky::detail::anon_sender{};
+		const auto& I = pimpl(H);
+		if(const auto E = I.super_engine(); E.has_actor())
+			checked_send<home_actor_t, P>(src, E.raw_actor(), xs...);
+		if(const auto home = I.existing_home(); home && I.home_listens(ack_event<Ts...>()))
+			checked_send<home_actor_t, P>(src, home, std::forward<Ts>(xs)...);
 	}
+
+	/// send message to home of another engine `H` from engine actor `src`
+	template<
+		caf::message_priority P = caf::message_priority::normal,
+		typename ActorClass, typename Handle, typename... Ts
+	>
+	static auto send_home_of(ActorClass& src, const Handle& H, Ts&&... xs) -> void {
+		using home_actor_t = typename engine_impl_t<Handle>::home_actor_type;
+		checked_send<home_actor_t, P>(src, H.raw_actor(), xs...);
+		const auto& I = pimpl(H);
+		if(const auto home = I.existing_home(); home && I.home_listens(
+			ack_event<Ts...>(), ack_is_deep(&src, xs...)
+		))
+			checked_send<home_actor_t, P>(src, home, std::forward<Ts>(xs)...);
+	}
+
+protected:
+	/// make ID of home group if it wasn't set explicitly, default is random UUID
+	virtual auto make_home_id() const -> std::string;
+
+private:
+	template<typename A, typename... Ts>
+	static constexpr bool has_atom_v = (std::is_same_v<meta::remove_cvref_t<Ts>, A> || ...);
+
+	// home group and it's ID are created on demand
+	mutable engine_impl_mutex home_guard_;
+	mutable caf::group home_;
+	mutable std::string home_id_;
+
+	// registered listeners & union of their masks
+	struct listener_rec {
+		std::uint64_t id;
+		Event mask;
+		bool deep;
+	};
+	std::vector<listener_rec> listeners_;
+	std::atomic<std::uint32_t> listen_mask_ = 0, deep_listen_mask_ = 0;
 };
 
 NAMESPACE_END(blue_sky::tree)
@@ -10,14 +10,18 @@
 
 #include <bs/atoms.h>
 #include <bs/error.h>
+#include <bs/propdict.h>
 
 #include "private_common.h"
+#include "ev_queue.h"
 #include "../kernel/radio_subsyst.h"
 
 #include <caf/actor_config.hpp>
 #include <caf/event_based_actor.hpp>
 
+#include <map>
 #include <optional>
+#include <unordered_map>
 
 NAMESPACE_BEGIN(blue_sky::tree)
 
@@ -45,12 +49,30 @@ struct ev_listener_actor : caf::event_based_actor {
 	// address of events source actor (engine)
 	const caf::actor_addr origin;
 
+	// events coalescing options
+	const event_batch_opts batch_opts;
+	// delivers batched event, for link listeners defaults to `handle_event()`
+	std::function< void(Event, prop::propdict) > batch_sink;
+
+	// bounded events queue options
+	const event_queue_opts queue_opts;
+	// makes queue sink that invokes callback moved into it, for link listeners callback is called as is
+	std::function< event_queue::sink_f(callback_t) > make_queue_sink;
+
 	ev_listener_actor(
 		caf::actor_config& cfg, caf::actor_addr ev_src, callback_t cb,
-		std::function< caf::message_handler(ev_listener_actor*) > make_event_behavior
+		std::function< caf::message_handler(ev_listener_actor*) > make_event_behavior,
+		event_batch_opts bopts = {}, event_queue_opts qopts = {}
 	)
-		: super(cfg), f_(make_safe_callback(std::move(cb))), f(*f_), origin(std::move(ev_src))
+		: super(cfg), f_(make_safe_callback(std::move(cb))), f(*f_), origin(std::move(ev_src)),
+		batch_opts(std::move(bopts)), queue_opts(std::move(qopts))
 	{
+		// node listeners set batch & queue sinks themselves, because callback also accepts root node
+		if constexpr(std::is_invocable_v<callback_t, event>) {
+			batch_sink = [this](Event ev, prop::propdict params) { handle_event(ev, std::move(params)); };
+			make_queue_sink = [](callback_t cb) -> event_queue::sink_f { return std::move(cb); };
+		}
+
 		// silently drop all other messages not in my character
 		set_default_handler(noop_r<caf::message>());
 
@@ -67,11 +89,29 @@ struct ev_listener_actor : caf::event_based_actor {
 				join(src_home);
 				return id();
 			},
+			// deliver batch if it wasn't already flushed by count
+			[=](a_flush, std::uint64_t gen) {
+				if(gen == batch_.gen) flush_batch();
+			},
 			// exit on a_bye
-			[=](a_bye) { quit(); }
+			[=](a_bye) {
+				flush_batch();
+				quit();
+			}
 		}.unbox());
 	}
 
+	/// spawn listener with lazy init
+	static auto spawn(
+		caf::actor_addr ev_src, callback_t cb,
+		std::function< caf::message_handler(ev_listener_actor*) > make_event_behavior,
+		event_batch_opts bopts = {}, event_queue_opts qopts = {}
+	) -> caf::actor {
+		return KRADIO.system().spawn<ev_listener_actor, caf::lazy_init>(
+			std::move(ev_src), std::move(cb), std::move(make_event_behavior), bopts, qopts
+		);
+	}
+
 	auto name() const -> const char* override { return "ev_listener_actor"; }
 
 	auto make_behavior() -> behavior_type override {
@@ -79,21 +119,136 @@ struct ev_listener_actor : caf::event_based_actor {
 	}
 
 	auto on_exit() -> void override {
+		// pending events are still delivered by queue's worker
+		if(queue_) queue_->close();
 		// destroy callback as early as possible
 		f_.reset();
 		KRADIO.release_citizen(this);
 	}
 
 	auto handle_event(Event ev, prop::propdict params) {
-		if(auto A = caf::actor_cast<caf::actor>(origin))
-			f(event{std::move(A), std::move(params), ev});
+		if(auto A = caf::actor_cast<caf::actor>(origin)) {
+			auto E = event{std::move(A), std::move(params), ev};
+			if(!enqueue(E)) f(std::move(E));
+		}
 		else
 			quit();
 	}
 
+	/// pass event to bounded queue, returns false if queue is off
+	/// [NOTE] callback is moved into queue on first event
+	auto enqueue(event& ev) -> bool {
+		if(!queue_opts.bounded()) return false;
+		if(!queue_)
+			queue_ = event_queue::make(this->id(), queue_opts, make_queue_sink(std::move(*f_)));
+		queue_->push(std::move(ev));
+		return true;
+	}
+
+	///////////////////////////////////////////////////////////////////////////////
+	//  events coalescing
+	//
+	/// put event about link `lid` into batch, returns false if coalescing is off
+	auto coalesce(Event ev, const lid_type& lid) -> bool {
+		if(!batch_opts.enabled()) return false;
+		batch_add(ev, lid);
+		batch_commit();
+		return true;
+	}
+
+	/// same as above for event that affects several links
+	auto coalesce(Event ev, const lids_v& lids) -> bool {
+		if(!batch_opts.enabled()) return false;
+		for(const auto& lid : lids)
+			batch_add(ev, lid);
+		batch_commit();
+		return true;
+	}
+
+	/// status transitions are merged: first previous & last new status are remembered
+	auto coalesce(const lid_type& lid, Req req, ReqStatus new_s, ReqStatus prev_s) -> bool {
+		if(!batch_opts.enabled()) return false;
+		// `LinkStatusChanged` flag is set on flush if status really changed
+		const auto pos = batch_add(Event::Nil, lid);
+		auto [S, is_inserted] = batch_.status.try_emplace({pos, req}, prev_s, new_s);
+		if(!is_inserted) S->second.second = new_s;
+		batch_commit();
+		return true;
+	}
+
+	/// deliver accumulated events as single batched event
+	auto flush_batch() -> void {
+		using namespace allow_enumops;
+		if(!batch_.count) return;
+		auto B = std::move(batch_);
+		batch_ = {};
+		batch_.gen = B.gen + 1;
+
+		for(const auto& [key, S] : B.status) {
+			if(S.first != S.second)
+				B.codes[key.first] |= Event::LinkStatusChanged;
+		}
+
+		// skip links with no net changes
+		auto lids = lids_v{};
+		auto codes = prop::list_of<prop::integer>{};
+		auto code = Event::Nil;
+		for(std::size_t i = 0; i < B.lids.size(); ++i) {
+			if(B.codes[i] == Event::Nil) continue;
+			lids.push_back(B.lids[i]);
+			codes.push_back(prop::integer(B.codes[i]));
+			code |= B.codes[i];
+		}
+		if(code == Event::Nil) return;
+
+		batch_sink(code, {
+			{"lids", std::move(lids)},
+			{"events", std::move(codes)},
+			{"count", prop::integer(B.count)}
+		});
+	}
+
 private:
 	// temp storage for event handlers between ctor and make_behavior()
 	caf::behavior character;
+
+	// bounded queue is started on first event
+	sp_event_queue queue_;
+
+	// accumulated events
+	struct ev_batch {
+		// affected links in order of appearance and their aggregated events flags
+		lids_v lids;
+		std::vector<Event> codes;
+		std::unordered_map<lid_type, std::size_t> index;
+		// (link pos, request) -> (first previous, last new) status
+		std::map<std::pair<std::size_t, Req>, std::pair<ReqStatus, ReqStatus>> status;
+		// number of coalesced events
+		std::size_t count = 0;
+		// batch generation, used to skip timer messages of already delivered batches
+		std::uint64_t gen = 0;
+	};
+	ev_batch batch_;
+
+	auto batch_add(Event ev, const lid_type& lid) -> std::size_t {
+		using namespace allow_enumops;
+		auto [pos, is_inserted] = batch_.index.try_emplace(lid, batch_.lids.size());
+		if(is_inserted) {
+			batch_.lids.push_back(lid);
+			batch_.codes.push_back(ev);
+		}
+		else
+			batch_.codes[pos->second] |= ev;
+		return pos->second;
+	}
+
+	auto batch_commit() -> void {
+		// start timer on first event in batch
+		if(++batch_.count == 1 && batch_opts.window > timespan::zero())
+			this->delayed_send(this, batch_opts.window, a_flush(), batch_.gen);
+		if(batch_opts.max_count && batch_.count >= batch_opts.max_count)
+			flush_batch();
+	}
 };
 
 NAMESPACE_END(blue_sky::tree)
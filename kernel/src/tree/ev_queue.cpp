@@ -0,0 +1,124 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Bounded events queue implementation
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+
+#include "ev_queue.h"
+
+#include <bs/propdict.h>
+#include <bs/kernel/radio.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+NAMESPACE_BEGIN(blue_sky::tree)
+NAMESPACE_BEGIN()
+
+// listener ID -> it's queue
+auto queues_guard_ = std::mutex{};
+auto queues_ = std::unordered_map<std::uint64_t, std::weak_ptr<event_queue>>{};
+
+// events are merged if they have same code, origin & affected link
+auto same_link(const event& lhs, const event& rhs) -> bool {
+	if(lhs.code != rhs.code || lhs.origin != rhs.origin) return false;
+	const auto lhs_id = prop::get_if<lid_type>(&lhs.params, "link_id");
+	const auto rhs_id = prop::get_if<lid_type>(&rhs.params, "link_id");
+	return lhs_id && rhs_id ? *lhs_id == *rhs_id : !lhs_id && !rhs_id;
+}
+
+NAMESPACE_END()
+
+event_queue::event_queue(std::uint64_t listener_id, event_queue_opts opts, sink_f sink)
+	: listener_id_(listener_id), opts_(std::move(opts)), sink_(std::move(sink))
+{}
+
+event_queue::~event_queue() {
+	auto guard = std::lock_guard{queues_guard_};
+	// entry can already point to queue of new listener with same ID
+	if(auto pos = queues_.find(listener_id_); pos != queues_.end() && pos->second.expired())
+		queues_.erase(pos);
+}
+
+auto event_queue::make(std::uint64_t listener_id, event_queue_opts opts, sink_f sink) -> sp_event_queue {
+	auto Q = std::make_shared<event_queue>(listener_id, std::move(opts), std::move(sink));
+	{
+		auto guard = std::lock_guard{queues_guard_};
+		queues_[listener_id] = Q;
+	}
+	// worker holds queue until it's closed
+	kernel::radio::system().spawn<caf::detached>([Q] { Q->run(); });
+	return Q;
+}
+
+auto event_queue::find(std::uint64_t listener_id) -> sp_event_queue {
+	auto guard = std::lock_guard{queues_guard_};
+	if(auto pos = queues_.find(listener_id); pos != queues_.end())
+		return pos->second.lock();
+	return nullptr;
+}
+
+auto event_queue::push(event ev) -> void {
+	auto guard = std::unique_lock{guard_};
+	if(closed_) return;
+
+	if(events_.size() >= opts_.capacity) {
+		switch(opts_.overflow) {
+		case EventOverflow::CoalesceLatest:
+			// replace pending event about same link, it keeps it's place in queue
+			if(auto pos = std::find_if(
+				events_.begin(), events_.end(), [&](const auto& x) { return same_link(x, ev); }
+			); pos != events_.end()) {
+				*pos = std::move(ev);
+				++stats_.coalesced;
+				return;
+			}
+			[[fallthrough]];
+
+		default:
+			events_.pop_front();
+			++stats_.dropped;
+		}
+	}
+
+	events_.push_back(std::move(ev));
+	guard.unlock();
+	has_events_.notify_one();
+}
+
+auto event_queue::close() -> void {
+	{
+		auto guard = std::lock_guard{guard_};
+		closed_ = true;
+	}
+	has_events_.notify_all();
+}
+
+auto event_queue::stats() const -> event_queue_stats {
+	auto guard = std::lock_guard{guard_};
+	auto res = stats_;
+	res.pending = events_.size();
+	return res;
+}
+
+auto event_queue::run() -> void {
+	while(true) {
+		auto guard = std::unique_lock{guard_};
+		has_events_.wait(guard, [&] { return closed_ || !events_.empty(); });
+		if(events_.empty()) break;
+
+		auto ev = std::move(events_.front());
+		events_.pop_front();
+		++stats_.delivered;
+		guard.unlock();
+
+		sink_(std::move(ev));
+	}
+	// release callback as early as possible
+	sink_ = nullptr;
+}
+
+NAMESPACE_END(blue_sky::tree)
@@ -0,0 +1,60 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Bounded queue of events between listener actor and subscriber's callback
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+#pragma once
+
+#include <bs/tree/common.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+NAMESPACE_BEGIN(blue_sky::tree)
+
+/// events are pushed by listener actor and passed to callback by dedicated worker,
+/// so slow callback can't make listener's mailbox grow without limit
+class BS_HIDDEN_API event_queue {
+public:
+	using sink_f = std::function< void(event) >;
+	using sp_event_queue = std::shared_ptr<event_queue>;
+
+	/// make queue of listener with given ID & start worker that passes events to `sink`
+	static auto make(std::uint64_t listener_id, event_queue_opts opts, sink_f sink) -> sp_event_queue;
+	/// find queue of listener with given ID, returns nullptr if there's none
+	static auto find(std::uint64_t listener_id) -> sp_event_queue;
+
+	/// put event into queue, if queue is full overflow policy is applied
+	/// [NOTE] never waits, so listener's mailbox is drained at the rate events arrive
+	auto push(event ev) -> void;
+	/// stop accepting events, worker exits after pending events are delivered
+	auto close() -> void;
+
+	auto stats() const -> event_queue_stats;
+
+	event_queue(std::uint64_t listener_id, event_queue_opts opts, sink_f sink);
+	~event_queue();
+
+private:
+	const std::uint64_t listener_id_;
+	const event_queue_opts opts_;
+	sink_f sink_;
+
+	mutable std::mutex guard_;
+	std::condition_variable has_events_;
+	std::deque<event> events_;
+	event_queue_stats stats_;
+	bool closed_ = false;
+
+	// worker's loop
+	auto run() -> void;
+};
+using sp_event_queue = event_queue::sp_event_queue;
+
+NAMESPACE_END(blue_sky::tree)
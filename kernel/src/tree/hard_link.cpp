@@ -31,8 +31,8 @@ static auto weak_impl_alloc = std::pmr::polymorphic_allocator<weak_link_impl>(&i
 /*-----------------------------------------------------------------------------
  *  hard_link_actor
  *-----------------------------------------------------------------------------*/
-hard_link_actor::hard_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_limpl Limpl) :
-	super(cfg, std::move(self_grp), std::move(Limpl))
+hard_link_actor::hard_link_actor(caf::actor_config& cfg, sp_limpl Limpl) :
+	super(cfg, std::move(Limpl))
 {
 	// if object is already initialized, monitor it
 	monitor_object();
@@ -45,8 +45,10 @@ auto hard_link_actor::monitor_object() -> void {
 		obj_hid_ = obj->home_id();
 		// weak_link: enter home group of object's node to receive it's events
 		if(impl.type_id() == weak_link::type_id_()) {
-			if(const auto N = obj->data_node())
+			if(const auto N = obj->data_node()) {
 				join(N.home());
+				node_impl::register_listener(N, this, Event::All, true);
+			}
 		}
 	}
 }
@@ -84,7 +84,7 @@ public:
 	>;
 
 	// if object is already initialized, auto-join it's group
-	hard_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_limpl Limpl);
+	hard_link_actor(caf::actor_config& cfg, sp_limpl Limpl);
 
 	auto make_typed_behavior() -> typed_behavior;
 	auto make_behavior() -> behavior_type override;
@@ -10,6 +10,9 @@
 #include "engine_impl.h"
 #include "link_actor.h"
 #include "nil_engine.h"
+#include "shard_executor.h"
+#include "tree_impl.h"
+#include "node_leafs_storage.h"
 
 #include <bs/log.h>
 #include <bs/tree/node.h>
@@ -93,10 +96,16 @@ auto link::pimpl() const -> link_impl* {
 }
 
 auto link::start_engine() -> bool {
-	if(nil_link::nil_engine() == raw_actor()) {
-		install_raw_actor(pimpl()->spawn_actor(std::static_pointer_cast<link_impl>(pimpl_)));
+	// [NOTE] compare handles to not trigger spawn of already installed lazy actor
+	if(actor_ == nil_link::actor()) {
+		// actor & home group are spawned on first access
+		install_lazy_actor([limpl = std::static_pointer_cast<link_impl>(pimpl_)] {
+			return limpl->spawn_actor(limpl);
+		});
 		// explicitly setup weak link from pimpl to engine
 		pimpl()->reset_super_engine(*this);
+		// make link discoverable by ID
+		detail::register_link(*this);
 		return true;
 	}
 	return false;
@@ -174,6 +183,10 @@ auto link::name(unsafe_t) const -> std::string {
 	return pimpl()->name_;
 }
 
+auto detail::name_key::operator()(const link& L) const -> const std::string& {
+	return L.pimpl()->name_;
+}
+
 auto link::oid() const -> std::string {
 	return pimpl()->actorf<std::string>(*this, a_lnk_oid())
 		.value_or(nil_oid);
@@ -222,6 +235,9 @@ auto link::is_node() const -> bool {
 //  apply
 //
 auto link::apply(link_transaction tr) const -> error {
+	// in sharded mode transaction is executed by link's shard & actor isn't spawned
+	if(auto shard = detail::link_shard(id()))
+		return actorf<tr_result>(shard, pimpl()->timeout(false), a_apply(), *this, std::move(tr));
 	return pimpl()->actorf<tr_result>(*this, a_apply(), std::move(tr));
 }
 
@@ -255,7 +271,10 @@ auto link::data_node(process_dnode_cb f, bool high_priority) const -> void {
 }
 
 auto link::apply(launch_async_t, link_transaction tr) const -> void {
-	caf::anon_send(pimpl()->actor(*this), a_apply(), std::move(tr));
+	if(auto shard = detail::link_shard(id()))
+		caf::anon_send(shard, a_apply(), *this, std::move(tr));
+	else
+		caf::anon_send(pimpl()->actor(*this), a_apply(), std::move(tr));
 }
 
 auto link::data_apply(launch_async_t, obj_transaction tr) const -> void {
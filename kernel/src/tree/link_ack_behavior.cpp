@@ -64,9 +64,19 @@ return {
 		forward_up(a_ack(), std::move(N), a_node_insert(), lid, pos1, pos2);
 	},
 
+	[=](a_ack, caf::actor N, a_node_insert, lids_v lids, std::vector<std::size_t> pos) {
+		adbg(this) << "<- [ack] [deep] a_node_insert [bulk]" << std::endl;
+		forward_up(a_ack(), std::move(N), a_node_insert(), std::move(lids), std::move(pos));
+	},
+
 	[=](a_ack, caf::actor N, a_node_erase, lids_v erased_leafs) {
 		adbg(this) << "<- [ack] [deep] a_node_erase" << std::endl;
 		forward_up(a_ack(), std::move(N), a_node_erase(), std::move(erased_leafs));
+	},
+
+	[=](a_ack, caf::actor N, a_node_stats, node::subtree_stats delta, bool add) {
+		adbg(this) << "<- [ack] [deep] a_node_stats" << std::endl;
+		forward_up(a_ack(), std::move(N), a_node_stats(), std::move(delta), add);
 	}
 }; }
 
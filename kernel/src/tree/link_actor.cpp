@@ -14,6 +14,7 @@
 
 #include "link_actor.h"
 #include "request_impl.h"
+#include "shard_executor.h"
 #include "../objbase_actor.h"
 
 #define DEBUG_ACTOR 0
@@ -29,11 +30,49 @@ using namespace std::chrono_literals;
 	return out;
 }
 
+NAMESPACE_BEGIN()
+
+// in sharded mode transactions of link are executed by it's shard, so state-changing requests
+// served by link actor are also evaluated there to be serialized with transactions
+// [NOTE] link actor awaits shard's answer, that preserves order of it's own messages
+template<typename F>
+auto on_shard(link_actor* self, F f) {
+	using R = std::invoke_result_t<F>;
+	using res_t = std::conditional_t<std::is_void_v<R>, void, caf::result<R>>;
+
+	const auto shard = detail::link_shard(self->impl.id_);
+	const auto L = shard ? self->impl.super_engine() : link{};
+	if(!L) return res_t(f());
+
+	if constexpr(std::is_void_v<R>) {
+		self->request(shard, caf::infinite, a_apply(), L, link_transaction{[=]() -> error {
+			f();
+			return perfect;
+		}})
+		.await([](const tr_result::box&) {}, [](const caf::error&) {});
+	}
+	else {
+		auto res = std::make_shared<R>();
+		auto rp = self->make_response_promise<R>();
+		self->request(shard, caf::infinite, a_apply(), L, link_transaction{[=]() -> error {
+			*res = f();
+			return perfect;
+		}})
+		.await(
+			[=](const tr_result::box&) mutable { rp.deliver(std::move(*res)); },
+			[=](const caf::error& er) mutable { rp.deliver(er); }
+		);
+		return res_t(rp);
+	}
+}
+
+NAMESPACE_END()
+
 /*-----------------------------------------------------------------------------
  *  link
  *-----------------------------------------------------------------------------*/
-link_actor::link_actor(caf::actor_config& cfg, caf::group home, sp_limpl Limpl) :
-	super(cfg, std::move(home), std::move(Limpl)), ropts_{ReqOpts::WaitIfBusy, ReqOpts::WaitIfBusy}
+link_actor::link_actor(caf::actor_config& cfg, sp_limpl Limpl) :
+	super(cfg, std::move(Limpl)), ropts_{ReqOpts::WaitIfBusy, ReqOpts::WaitIfBusy}
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -44,7 +83,7 @@ return {
 	// ignore `a_bye` signal - comes from self
 	[=](a_bye) {},
 
-	[=](a_home) { return impl.home; },
+	[=](a_home) { return impl.home(); },
 
 	[=](a_home_id) { return std::string(impl.home_id()); },
 
@@ -64,14 +103,18 @@ return {
 	// subscribe events listener
 	[=](a_subscribe, const caf::actor& baby) {
 		// remember baby & ensure it's alive
-		return delegate(caf::actor_cast<ev_listener_actor_type>(baby), a_hi(), impl.home);
+		return delegate(caf::actor_cast<ev_listener_actor_type>(baby), a_hi(), impl.home());
 	},
 
 	// apply link transaction
 	[=](a_apply, const link_transaction& tr) -> caf::result<tr_result::box> {
 		adbg(this) << "<- a_apply transaction" << std::endl;
-		if(const auto self = impl.super_engine())
+		if(const auto self = impl.super_engine()) {
+			// in sharded mode all transactions of link are serialized by it's shard
+			if(auto shard = detail::link_shard(impl.id_))
+				return delegate(shard, a_apply(), self, tr);
 			return tr_eval(this, tr, [&] { return self.bare(); });
+		}
 		return error::quiet(blue_sky::Error::TrEmptyTarget);
 	},
 
@@ -138,20 +181,21 @@ return {
 			return delegate(master.actor(), a_lnk_rename(), impl.id_, std::move(new_name));
 		}
 		// otherwise rename directly
-		else {
-			impl.rename(std::move(new_name));
-			return std::size_t{1};
-		}
+		else
+			return on_shard(this, [=] {
+				impl.rename(new_name);
+				return std::size_t{1};
+			});
 	},
 
 	// get status
 	[=](a_lnk_status, Req req) -> ReqStatus { return impl.req_status(req); },
 
 	// change status
-	[=](a_lnk_status, Req req, ReqReset cond, ReqStatus new_rs, ReqStatus prev_rs) -> ReqStatus {
+	[=](a_lnk_status, Req req, ReqReset cond, ReqStatus new_rs, ReqStatus prev_rs) -> caf::result<ReqStatus> {
 		adbg(this) << "<- a_lnk_status: " << to_string(req) << " " <<
 			to_string(prev_rs) << "->" << to_string(new_rs) << std::endl;
-		return impl.rs_reset(req, cond, new_rs, prev_rs);
+		return on_shard(this, [=] { return impl.rs_reset(req, cond, new_rs, prev_rs); });
 	},
 
 	// just send notification about just changed status
@@ -161,7 +205,7 @@ return {
 
 	// get/set flags
 	[=](a_lnk_flags) { return impl.flags_; },
-	[=](a_lnk_flags, Flags f) { impl.flags_ = f; },
+	[=](a_lnk_flags, Flags f) { on_shard(this, [=] { impl.flags_ = f; }); },
 
 	// obtain inode
 	// [NOTE] assume it's a fast call, override behaviour where needed (sym_link for ex)
@@ -205,8 +249,8 @@ auto link_actor::make_behavior() -> behavior_type {
 /*-----------------------------------------------------------------------------
  *  cached_link_actor
  *-----------------------------------------------------------------------------*/
-cached_link_actor::cached_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_limpl Limpl) :
-	link_actor(cfg, std::move(self_grp), std::move(Limpl))
+cached_link_actor::cached_link_actor(caf::actor_config& cfg, sp_limpl Limpl) :
+	link_actor(cfg, std::move(Limpl))
 {
 	ropts_ = {ReqOpts::HasDataCache, ReqOpts::HasDataCache};
 }
@@ -25,16 +25,20 @@ public:
 	using ack_actor_type = link_impl::ack_actor_type;
 	using behavior_type = super::behavior_type;
 
-	link_actor(caf::actor_config& cfg, caf::group home, sp_limpl Limpl);
+	link_actor(caf::actor_config& cfg, sp_limpl Limpl);
 
 	// pass message to upper (owner) level of tree structure
 	template<typename... Args>
 	auto forward_up(Args&&... args) -> void {
-		// link forward messages directly to owner's home group
-		if(auto master = impl.owner())
-			checked_send<node_impl::home_actor_type, high_prio>(
-				*this, master.home(), std::forward<Args>(args)...
-			);
+		// link forward messages directly to owner's home
+		if(auto master = impl.owner()) {
+			// own acks are always delivered to owner, subtree acks - only if someone listens to them
+			if constexpr(constexpr auto ev = link_impl::ack_event<Args...>(); ev != Event::Nil) {
+				if(link_impl::ack_is_deep(this, args...) && !node_impl::pimpl(master).deep_listens(ev))
+					return;
+			}
+			impl.send_home_of<high_prio>(*this, master, std::forward<Args>(args)...);
+		}
 	}
 
 	// forward 'ack' message to upper level, auto prepend it with this link ID info
@@ -58,15 +62,10 @@ protected:
 	req_opts ropts_;
 };
 
-// spawns link actor inside link home group
+// spawns link actor, home group is created later on demand
 template<typename Actor, caf::spawn_options Os = caf::no_spawn_options, class... Ts>
 inline auto spawn_lactor(sp_limpl limpl, Ts&&... args) {
-	// spawn actor
-	auto& AS = kernel::radio::system();
-	auto lgrp = AS.groups().get_local(to_string(limpl->id_));
-	return AS.spawn_in_group<Actor, Os>(
-		lgrp, lgrp, std::move(limpl), std::forward<Ts>(args)...
-	);
+	return kernel::radio::system().spawn<Actor, Os>(std::move(limpl), std::forward<Ts>(args)...);
 }
 
 /*-----------------------------------------------------------------------------
@@ -78,7 +77,7 @@ struct BS_HIDDEN_API cached_link_actor : public link_actor {
 	using super = link_actor;
 	using super::typed_behavior;
 
-	cached_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_limpl Limpl);
+	cached_link_actor(caf::actor_config& cfg, sp_limpl Limpl);
 
 	// part of behavior overloaded by this actor
 	// OID & obj type ID getters always applied to data cache
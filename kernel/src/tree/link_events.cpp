@@ -17,17 +17,26 @@
 NAMESPACE_BEGIN(blue_sky::tree)
 using event_handler = link::event_handler;
 
-static auto make_listener(const link& origin, event_handler f, Event listen_to) {
+static auto make_listener(
+	const link& origin, event_handler f, Event listen_to, event_batch_opts batch, event_queue_opts queue
+) {
 	using namespace kernel::radio;
 	using namespace allow_enumops;
 	using baby_t = ev_listener_actor<link>;
 
 	// produce event bhavior that calls passed callback with proper params
-	auto make_ev_character = [src_id = origin.id(), listen_to](baby_t* self) {
+	auto make_ev_character = [weak_root = link::weak_ptr(origin), src_id = origin.id(), listen_to](
+		baby_t* self
+	) {
+		// let link know which events to broadcast
+		if(auto r = weak_root.lock())
+			link_impl::register_listener(r, self, listen_to, false);
+
 		auto res = caf::message_handler{};
 		if(enumval(listen_to & Event::LinkRenamed))
 			res = res.or_else(
 				[=](a_ack, a_lnk_rename, std::string new_name, std::string old_name) {
+					if(self->coalesce(Event::LinkRenamed, src_id)) return;
 					self->handle_event(Event::LinkRenamed, {
 						{"new_name", std::move(new_name)},
 						{"prev_name", std::move(old_name)}
@@ -38,6 +47,7 @@ static auto make_listener(const link& origin, event_handler f, Event listen_to)
 		if(enumval(listen_to & Event::LinkStatusChanged))
 			res = res.or_else(
 				[=](a_ack, a_lnk_status, Req request, ReqStatus new_v, ReqStatus prev_v) {
+					if(self->coalesce(src_id, request, new_v, prev_v)) return;
 					self->handle_event(Event::LinkStatusChanged, {
 						{"request", new_v},
 						{"new_status", new_v},
@@ -49,6 +59,7 @@ static auto make_listener(const link& origin, event_handler f, Event listen_to)
 		if(enumval(listen_to & Event::DataModified))
 			res = res.or_else(
 				[=](a_ack, a_data, tr_result::box tres_box) {
+					if(self->coalesce(Event::DataModified, src_id)) return;
 					auto params = prop::propdict{};
 					if(auto tres = tr_result{std::move(tres_box)})
 						params = extract_info(std::move(tres));
@@ -61,11 +72,13 @@ static auto make_listener(const link& origin, event_handler f, Event listen_to)
 		if(enumval(listen_to & Event::LinkDeleted))
 			res = res.or_else(
 				[=](a_bye) {
+					self->flush_batch();
 					self->quit();
 					// distinguish link's bye signal from kernel kill all
 					if(self->current_sender() == self->origin) {
 						// [NOTE] link can possibly be already expired but callback needs to be called
-						self->f({nullptr, {{"link_id", src_id}}, Event::LinkDeleted});
+						auto E = event{nullptr, {{"link_id", src_id}}, Event::LinkDeleted};
+						if(!self->enqueue(E)) self->f(std::move(E));
 					}
 				}
 			);
@@ -74,24 +87,29 @@ static auto make_listener(const link& origin, event_handler f, Event listen_to)
 	};
 
 	// make baby event handler actor
-	return system().spawn<baby_t, caf::lazy_init>(
-		origin.actor().address(), std::move(f), std::move(make_ev_character)
+	return baby_t::spawn(
+		origin.actor().address(), std::move(f), std::move(make_ev_character), batch, queue
 	);
 }
 
-auto link::subscribe(event_handler f, Event listen_to) const -> std::uint64_t {
+auto link::subscribe(
+	event_handler f, Event listen_to, event_batch_opts batch, event_queue_opts queue
+) const -> std::uint64_t {
 	// ensure it has started & properly initialized
 	// throw exception otherwise
 	if(auto res = link_impl::actorf<std::uint64_t>(
-		*this, a_subscribe_v, make_listener(*this, std::move(f), listen_to)
+		*this, a_subscribe_v, make_listener(*this, std::move(f), listen_to, batch, queue)
 	))
 		return *res;
 	else
 		throw res.error();
 }
 
-auto link::subscribe(launch_async_t, event_handler f, Event listen_to) const -> std::uint64_t {
-	auto baby = make_listener(*this, std::move(f), listen_to);
+auto link::subscribe(
+	launch_async_t, event_handler f, Event listen_to, event_batch_opts batch,
+	event_queue_opts queue
+) const -> std::uint64_t {
+	auto baby = make_listener(*this, std::move(f), listen_to, batch, queue);
 	auto baby_id = baby.id();
 	caf::anon_send(pimpl()->actor(*this), a_subscribe{}, std::move(baby));
 	return baby_id;
@@ -9,6 +9,7 @@
 
 #include "link_impl.h"
 #include "link_actor.h"
+#include "tree_impl.h"
 
 #include <bs/atoms.h>
 #include <bs/actor_common.h>
@@ -16,7 +17,11 @@
 #include <bs/uuid.h>
 #include <bs/kernel/tools.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <optional>
+#include <unordered_map>
 
 NAMESPACE_BEGIN(blue_sky::tree)
 /*-----------------------------------------------------------------------------
@@ -30,12 +35,18 @@ link_impl::link_impl()
 	: link_impl({}, Flags::Nil)
 {}
 
-link_impl::~link_impl() = default;
+link_impl::~link_impl() {
+	detail::unregister_link(id_);
+}
 
 auto link_impl::spawn_actor(sp_limpl limpl) const -> caf::actor {
 	return spawn_lactor<link_actor>(std::move(limpl));
 }
 
+auto link_impl::make_home_id() const -> std::string {
+	return to_string(id_);
+}
+
 auto link_impl::data(unsafe_t) const -> sp_obj { return nullptr; }
 
 auto link_impl::data_node(unsafe_t) const -> node {
@@ -64,8 +75,123 @@ auto link_impl::owner() const -> node {
 }
 
 auto link_impl::reset_owner(const node& new_owner) -> void {
-	auto guard = lock();
-	owner_ = new_owner;
+	{
+		auto guard = lock();
+		if(owner_ == new_owner) return;
+		owner_ = new_owner;
+		++path_version_;
+		touch_paths();
+	}
+	// paths of link and whole subtree below it are changed
+	if(auto paths = std::atomic_exchange(&abspath_, sp_abspath_cache{}))
+		paths->expire();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  abspath
+//
+NAMESPACE_BEGIN()
+
+std::atomic<std::uint64_t> paths_epoch_ = 0;
+
+NAMESPACE_END()
+
+auto link_impl::paths_epoch() -> std::uint64_t {
+	return paths_epoch_.load();
+}
+
+auto link_impl::touch_paths() -> void {
+	++paths_epoch_;
+}
+
+auto link_impl::abspath_cache::expire() const -> void {
+	auto children = decltype(children_){};
+	{
+		auto guard = std::lock_guard{children_guard_};
+		if(expired_.exchange(true, std::memory_order_acq_rel)) return;
+		children.swap(children_);
+	}
+	for(const auto& wchild : children) {
+		if(const auto child = wchild.lock())
+			child->expire();
+	}
+}
+
+auto link_impl::abspath_cache::add_child(std::shared_ptr<const abspath_cache> child) const -> bool {
+	auto guard = std::lock_guard{children_guard_};
+	if(is_expired()) return false;
+	// drop entries of already expired (or destroyed) children when storage grows
+	if(children_.size() == children_.capacity()) {
+		children_.erase(std::remove_if(
+			children_.begin(), children_.end(),
+			[](const auto& wchild) {
+				const auto child = wchild.lock();
+				return !child || child->is_expired();
+			}
+		), children_.end());
+	}
+	children_.push_back(std::move(child));
+	return true;
+}
+
+auto link_impl::abspath() const -> sp_abspath_cache {
+	// fast path: neither link nor it's ancestors were renamed or moved since paths were built
+	if(auto res = std::atomic_load(&abspath_); res && !res->is_expired())
+		return res;
+
+	auto version = std::uint64_t{};
+	auto parent = node{};
+	auto name = std::string{};
+	{
+		auto guard = lock(blue_sky::detail::shared);
+		version = path_version_;
+		parent = owner_.lock();
+		name = name_;
+	}
+
+	auto res = std::make_shared<abspath_cache>();
+	auto parent_paths = sp_abspath_cache{};
+	if(parent) {
+		// paths of parent are built on top of it's handle paths (that are also cached)
+		parent_paths = pimpl(parent).abspath_base();
+		res->id_path = parent_paths->id_path;
+		res->name_path = parent_paths->name_path;
+		res->id_path += '/';
+		res->id_path += to_string(id_);
+		res->name_path += '/';
+		res->name_path += name;
+	}
+	else {
+		// [NOTE] root ID is irrelevant => abs path always starts with '/'
+		res->id_path = "/";
+		res->name_path = "/";
+	}
+	// don't cache paths if parent paths expired while being used
+	if(parent_paths && !parent_paths->add_child(res))
+		return res;
+
+	auto guard = lock(blue_sky::detail::shared);
+	// don't cache paths if link was changed while paths were built
+	if(path_version_ != version) return res;
+	if(auto prev = std::atomic_exchange(&abspath_, sp_abspath_cache{res}); prev && prev != res)
+		prev->expire();
+	return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  acks
+//
+template<typename... Ts>
+auto link_impl::send_ack(Ts&&... xs) -> void {
+	auto src = blue_sky::detail::anon_sender{};
+	if(const auto self = super_engine(); self.has_actor())
+		checked_send<home_actor_type, high_prio>(src, self.raw_actor(), a_ack(), xs...);
+	// [NOTE] do the same as `link_actor::ack_up()`
+	else if(const auto master = owner())
+		send_home_of<high_prio>(src, master, a_ack(), id_, xs...);
+
+	if(const auto home = existing_home(); home && home_listens(ack_event<Ts...>()))
+		checked_send<home_actor_type, high_prio>(src, home, a_ack(), std::forward<Ts>(xs)...);
 }
 
 auto link_impl::req_status(Req request) const -> ReqStatus {
@@ -136,7 +262,7 @@ auto link_impl::rs_reset(Req request, ReqReset cond, ReqStatus new_rs, ReqStatus
 	return rs_reset(request, cond, new_rs, old_rs, [&](auto req, auto new_rs, auto prev_rs, status_handle&) {
 		// send notification to link's home group if status changed or new value is OK
 		if(new_rs != prev_rs || new_rs == ReqStatus::OK)
-			send_home<high_prio>(*this, a_ack(), a_lnk_status(), req, new_rs, prev_rs);
+			send_ack(a_lnk_status(), req, new_rs, prev_rs);
 		return true;
 	});
 }
@@ -181,7 +307,7 @@ auto link_impl::rs_update_from_data(req_result rdata, bool broadcast) -> void {
 		const auto req_transaction = [&](Req, ReqStatus new_rs, ReqStatus old_rs, status_handle&) {
 			// send notification strictly if status changes
 			if(new_rs != old_rs)
-				send_home<high_prio>(*this, a_ack(), a_lnk_status(), req, new_rs, old_rs);
+				send_ack(a_lnk_status(), req, new_rs, old_rs);
 
 			// for Data request if object is nil -> return error
 			if constexpr(req == Req::Data) {
@@ -210,13 +336,18 @@ auto link_impl::rs_update_from_data(req_result rdata, bool broadcast) -> void {
 }
 
 auto link_impl::rename(std::string new_name)-> void {
-	if(new_name == name_) return;
-	auto old_name = std::move(name_);
-	name_ = std::move(new_name);
-	// notify home group
-	checked_send<home_actor_type, high_prio>(
-		home, a_ack(), a_lnk_rename(), name_, std::move(old_name)
-	);
+	auto old_name = std::string{};
+	{
+		auto guard = lock();
+		if(new_name == name_) return;
+		old_name = std::exchange(name_, new_name);
+		++path_version_;
+	}
+	// name paths of link and whole subtree below it are changed
+	if(auto paths = std::atomic_exchange(&abspath_, sp_abspath_cache{}))
+		paths->expire();
+	// notify home group & owner
+	send_ack(a_lnk_rename(), std::move(new_name), std::move(old_name));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -256,6 +387,108 @@ auto ilink_impl::get_inode() -> result_or_err<inodeptr> {
 	return inode_;
 };
 
+/*-----------------------------------------------------------------------------
+ *  links registry
+ *-----------------------------------------------------------------------------*/
+NAMESPACE_BEGIN()
+
+// registry is sharded by link ID to reduce contention between links started in parallel
+struct links_registry {
+	static constexpr std::size_t n_shards = 64;
+
+	struct shard {
+		engine_impl_mutex guard;
+		std::unordered_map<lid_type, std::vector<link::weak_ptr>, boost::hash<lid_type>> links;
+	};
+
+	auto operator[](const lid_type& lid) -> shard& {
+		return shards_[boost::hash<lid_type>{}(lid) % n_shards];
+	}
+
+private:
+	std::array<shard, n_shards> shards_;
+};
+
+auto registry() -> links_registry& {
+	// [NOTE] intentionally leaked, because link impls can be destroyed after static objects at exit
+	static auto* self = new links_registry;
+	return *self;
+}
+
+NAMESPACE_END()
+
+NAMESPACE_BEGIN(detail)
+
+auto register_link(const link& L) -> void {
+	const auto lid = L.id();
+	if(lid == nil_uid) return;
+	auto& S = registry()[lid];
+	auto guard = std::unique_lock{S.guard};
+	auto& Ls = S.links[lid];
+	// reuse slot of expired link
+	if(auto pos = std::find_if(Ls.begin(), Ls.end(), [](auto& wL) { return wL.expired(); }); pos != Ls.end())
+		*pos = L;
+	else
+		Ls.emplace_back(L);
+}
+
+auto unregister_link(const lid_type& lid) -> void {
+	auto& S = registry()[lid];
+	auto guard = std::unique_lock{S.guard};
+	if(auto pos = S.links.find(lid); pos != S.links.end()) {
+		auto& Ls = pos->second;
+		Ls.erase(std::remove_if(Ls.begin(), Ls.end(), [](auto& wL) { return wL.expired(); }), Ls.end());
+		if(Ls.empty()) S.links.erase(pos);
+	}
+}
+
+auto registered_links(const lid_type& lid) -> links_v {
+	auto res = links_v{};
+	auto& S = registry()[lid];
+	auto guard = std::shared_lock{S.guard};
+	if(auto pos = S.links.find(lid); pos != S.links.end()) {
+		res.reserve(pos->second.size());
+		for(const auto& wL : pos->second) {
+			if(auto L = wL.lock())
+				res.push_back(std::move(L));
+		}
+	}
+	return res;
+}
+
+auto deref_registered(const lids_v& path, const node& root) -> links_v {
+	if(path.empty() || !root) return {};
+	auto res = links_v(path.size());
+	for(auto L : registered_links(path.back())) {
+		// walk up from found link checking that it's parents match given path
+		for(auto i = path.size() - 1; L && L.id() == path[i]; --i) {
+			res[i] = L;
+			const auto parent = L.owner();
+			if(!i) {
+				if(parent == root) return res;
+				break;
+			}
+			L = parent ? parent.handle() : link{};
+		}
+	}
+	return {};
+}
+
+auto find_registered(const lid_type& lid, const node& root) -> link {
+	if(!root) return {};
+	for(const auto& L : registered_links(lid)) {
+		// ancestry check: `root` must be met on the way up from link
+		for(auto parent = L.owner(); parent;) {
+			if(parent == root) return L;
+			const auto parent_h = parent.handle();
+			parent = parent_h ? parent_h.owner() : node::nil();
+		}
+	}
+	return {};
+}
+
+NAMESPACE_END(detail)
+
 /*-----------------------------------------------------------------------------
  *  misc
  *-----------------------------------------------------------------------------*/
@@ -17,12 +17,16 @@
 
 #include "private_common.h"
 #include "engine_impl.h"
+#include "tree_impl.h"
 
 #include <caf/actor.hpp>
 #include <caf/result.hpp>
 #include <caf/typed_actor.hpp>
 
+#include <atomic>
+#include <mutex>
 #include <variant>
+#include <vector>
 
 #define LINK_TYPE_DEF(lnk_class, limpl_class, typename)                            \
 ENGINE_TYPE_DEF(limpl_class, typename)                                             \
@@ -82,7 +86,10 @@ public:
 		// node acks from deeper levels
 		caf::reacts_to<a_ack, caf::actor, a_node_insert, lid_type, size_t>,
 		caf::reacts_to<a_ack, caf::actor, a_node_insert, lid_type, size_t, size_t>,
-		caf::reacts_to<a_ack, caf::actor, a_node_erase, lids_v>
+		caf::reacts_to<a_ack, caf::actor, a_node_insert, lids_v, std::vector<std::size_t>>,
+		caf::reacts_to<a_ack, caf::actor, a_node_erase, lids_v>,
+		// subtree stats delta, bool flag = true means added, false - subtracted
+		caf::reacts_to<a_ack, caf::actor, a_node_stats, node::subtree_stats, bool>
 	>;
 
 	// all acks processed by link
@@ -110,6 +117,9 @@ public:
 	/// spawn raw actor corresponding to this impl type
 	virtual auto spawn_actor(sp_limpl limpl) const -> caf::actor;
 
+	/// link's home group ID is link ID
+	auto make_home_id() const -> std::string override;
+
 	/// clone this impl
 	virtual auto clone(link_actor* papa, bool deep = false) const -> caf::result<sp_limpl> = 0;
 
@@ -141,6 +151,34 @@ public:
 	// rename and send notification to home group
 	auto rename(std::string new_name) -> void;
 
+	/// absolute paths of link in ID and name form, built once and cached until link or any of it's
+	/// ancestors is renamed or moved
+	/// [NOTE] cached paths are invalidated by pushing expiration down to dependent entries,
+	/// so valid cached value is returned in O(1) without climbing up the tree
+	struct abspath_cache {
+		std::string id_path;
+		std::string name_path;
+
+		auto is_expired() const -> bool { return expired_.load(std::memory_order_acquire); }
+		// mark paths and all paths built on top of them as expired
+		auto expire() const -> void;
+		// register paths built on top of this entry, returns false if this entry is already expired
+		auto add_child(std::shared_ptr<const abspath_cache> child) const -> bool;
+
+	private:
+		mutable std::atomic<bool> expired_ = false;
+		mutable std::mutex children_guard_;
+		mutable std::vector<std::weak_ptr<const abspath_cache>> children_;
+	};
+	using sp_abspath_cache = std::shared_ptr<const abspath_cache>;
+
+	auto abspath() const -> sp_abspath_cache;
+	static auto abspath(const link& L) -> sp_abspath_cache { return L.pimpl()->abspath(); }
+
+	/// global counter of modifications that can change ancestry of links (owner or node handle)
+	static auto paths_epoch() -> std::uint64_t;
+	static auto touch_paths() -> void;
+
 	/// create or set or create inode for given target object
 	/// [NOTE] if `new_info` is non-null, returned inode may be NOT EQUAL to `new_info`
 	static auto make_inode(const sp_obj& target, inodeptr new_info = nullptr) -> inodeptr;
@@ -196,9 +234,19 @@ private:
 	status_handle status_[2];
 	// owner node
 	node::weak_ptr owner_;
+	// [NOTE] access only via atomic load/store
+	mutable sp_abspath_cache abspath_;
+	// bumped on rename & owner change, guarded by link's mutex
+	// prevents caching paths that were built from stale name or owner
+	std::uint64_t path_version_ = 0;
 
 	// direct access to status_handle
 	auto req_status_handle(Req request) -> status_handle&;
+
+	// send own ack to link's actor that retranslates it to owner node
+	// if actor isn't started (passive link, transactions run on shard), ack is delivered directly to owner
+	template<typename... Ts>
+	auto send_ack(Ts&&... xs) -> void;
 };
 using sp_limpl = link_impl::sp_limpl;
 
@@ -237,6 +285,16 @@ struct BS_HIDDEN_API sym_link_impl : link_impl {
 	auto propagate_handle() -> node_or_err override;
 
 	ENGINE_TYPE_DECL
+
+private:
+	// resolved target is cached while nodes along the path aren't modified
+	// [NOTE] access only via atomic load/store
+	mutable detail::sp_path_trace tcache_;
+
+	// returns nil link if cache is empty or outdated
+	auto cached_target(const node& parent) const -> link;
+	// cache plain path if no modifications happened in the tree since `start_epoch`
+	auto cache_target(const node& parent, const link& target, std::uint64_t start_epoch) const -> void;
 };
 
 auto to_string(Req) -> const char*;
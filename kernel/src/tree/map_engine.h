@@ -172,7 +172,7 @@ public:
 		caf::reacts_to<a_ack, a_node_erase, lid_type /* ID of erased link */, event>
 	>;
 
-	map_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_limpl Limpl);
+	map_link_actor(caf::actor_config& cfg, sp_limpl Limpl);
 
 	decltype(auto) mimpl() const { return static_cast<map_impl_base&>(impl); }
 
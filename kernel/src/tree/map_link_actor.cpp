@@ -94,6 +94,11 @@ auto input_ack_retranslator(
 		{ send_parent(Event::LinkInserted, lid, std::move(N)); },
 		// ignore moves within same node
 		[=](a_ack, const caf::actor& N, a_node_insert, const lid_type&, size_t, size_t) {},
+		// ack on bulk insert
+		[=](a_ack, const caf::actor& N, a_node_insert, const lids_v& lids, size_t) {
+			for(const auto& lid : lids)
+				send_parent(Event::LinkInserted, lid, N);
+		},
 		// ack on erase
 		[=](a_ack, const caf::actor& N, a_node_erase, const lids_v& erased_leafs) {
 			if(erased_leafs.empty()) return;
@@ -131,8 +136,8 @@ NAMESPACE_END()
 /*-----------------------------------------------------------------------------
  *  map_link_actor
  *-----------------------------------------------------------------------------*/
-map_link_actor::map_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_limpl Limpl) :
-	super(cfg, std::move(self_grp), std::move(Limpl))
+map_link_actor::map_link_actor(caf::actor_config& cfg, sp_limpl Limpl) :
+	super(cfg, std::move(Limpl))
 {
 	// auto-respawn listener when it exits
 	set_down_handler([=](const caf::down_msg&) {
@@ -140,13 +145,20 @@ map_link_actor::map_link_actor(caf::actor_config& cfg, caf::group self_grp, sp_l
 		adbg(this) << "starting listener on input node, is_nil = " << simpl.in_.is_nil()
 			<< ", update_on = " << enumval(simpl.update_on_) << std::endl;
 
-		if(simpl.in_ && enumval(simpl.update_on_))
+		using namespace allow_enumops;
+		if(simpl.in_ && enumval(simpl.update_on_)) {
 			// [NOTE] spawn monitored actor <=> calling monitor(...) afterwards
 			inp_listener_ = this->spawn_in_group<caf::monitored>(
 				simpl.in_.home(), input_ack_retranslator,
 				caf::actor_cast<map_impl_base::map_actor_type>(this), simpl.in_.actor(), simpl.out_.actor(),
 				simpl.update_on_, simpl.opts_
 			);
+			// let input node know which events to broadcast
+			node_impl::register_listener(
+				simpl.in_, caf::actor_cast<caf::abstract_actor*>(inp_listener_),
+				simpl.update_on_, enumval(simpl.opts_ & TreeOpts::Deep)
+			);
+		}
 		else {
 			inp_listener_ = nullptr;
 			adbg(this) << "~~~ Event listener not started!" << std::endl;
@@ -8,6 +8,7 @@
 /// You can obtain one at https://mozilla.org/MPL/2.0/
 #pragma once
 
+#include <bs/defaults.h>
 #include <bs/tree/engine.h>
 #include <bs/kernel/radio.h>
 
@@ -50,6 +51,11 @@ struct nil_engine_impl : ItemImpl {
 		std::atomic<bool> online_;
 	};
 
+	// all nil elements share same home ID
+	auto make_home_id() const -> std::string override {
+		return std::string{defaults::tree::nil_oid};
+	}
+
 	static auto internals() -> nil_engine& {
 		static auto self_ = nil_engine(
 			kernel::radio::system().spawn<typename NilItem::self_actor>(),
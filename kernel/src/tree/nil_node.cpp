@@ -37,6 +37,9 @@ struct nil_node::self_actor : nil_engine_actor {
 		[](a_node_keys, Key) -> lids_v { return {}; },
 		[](a_node_keys, Key, Key) -> std::vector<std::string> { return {}; },
 		[](a_node_ikeys, Key) -> std::vector<std::size_t> { return {}; },
+		[](a_node_leafs, Key, std::size_t, std::size_t) -> links_v { return {}; },
+		[](a_node_keys, Key, std::size_t, std::size_t) -> lids_v { return {}; },
+		[](a_node_ikeys, Key, std::size_t, std::size_t) -> std::vector<std::size_t> { return {}; },
 
 		[](a_node_find, lid_type) -> link { return link{}; },
 		[](a_node_find, std::size_t) -> link { return link{}; },
@@ -59,6 +62,7 @@ struct nil_node::self_actor : nil_engine_actor {
 		[](a_node_erase, const std::string&, Key) -> std::size_t { return 0; },
 		[](a_node_erase, const lids_v&) -> std::size_t { return 0; },
 		[](a_node_clear) -> std::size_t { return 0; },
+		[](a_node_stats) -> node::subtree_stats { return {}; },
 
 		[](a_lnk_rename, lid_type,           const std::string&) -> std::size_t { return 0; },
 		[](a_lnk_rename, std::size_t,        const std::string&) -> std::size_t { return 0; },
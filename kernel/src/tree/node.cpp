@@ -15,6 +15,7 @@
 #include <bs/log.h>
 #include <bs/tree/tree.h>
 
+#include <algorithm>
 #include <memory_resource>
 
 NAMESPACE_BEGIN(blue_sky::tree)
@@ -39,7 +40,9 @@ node::node(links_v leafs) :
 	node(std::allocate_shared<node_impl>(node_impl_alloc))
 {
 	// insert each link with proper locking
-	insert(std::move(leafs));
+	// [NOTE] empty node stays passive until first access to actor
+	if(!leafs.empty())
+		insert(std::move(leafs));
 }
 
 node::node(const bare_node& rhs) : node(rhs.armed()) {}
@@ -67,10 +70,14 @@ auto node::reset() -> void {
 }
 
 auto node::start_engine() -> bool {
-	if(nil_node::nil_engine() == raw_actor()) {
-		install_raw_actor(node_impl::spawn_actor(std::static_pointer_cast<node_impl>(pimpl_)));
+	// [NOTE] compare handles to not trigger spawn of already installed lazy actor
+	if(actor_ == nil_node::actor()) {
+		// actor & home group are spawned on first access
+		install_lazy_actor([nimpl = std::static_pointer_cast<node_impl>(pimpl_)] {
+			return node_impl::spawn_actor(nimpl);
+		});
 		// set myself as owner of my leafs
-		// [NOTE] can only be executed AFTER engine is installed & started
+		// [NOTE] can only be executed AFTER engine is installed
 		pimpl()->propagate_owner(*this, false);
 		return true;
 	}
@@ -98,6 +105,8 @@ auto node::clone(bool deep) const -> node {
 //  leafs container
 //
 auto node::size() const -> std::size_t {
+	if(auto S = pimpl()->snapshot())
+		return S->leafs.size();
 	return pimpl()->actorf<std::size_t>(*this, a_node_size()).value_or(0);
 }
 
@@ -105,21 +114,84 @@ auto node::empty() const -> bool {
 	return size() == 0;
 }
 
+auto node::stats() const -> subtree_stats {
+	return pimpl()->actorf<subtree_stats>(
+		*this, kernel::radio::timeout(true), a_node_stats()
+	).value_or(subtree_stats{});
+}
+
+auto node::subtree_stats::operator+=(const subtree_stats& rhs) -> subtree_stats& {
+	leafs += rhs.leafs;
+	nodes += rhs.nodes;
+	for(const auto& [otid, cnt] : rhs.types)
+		types[otid] += cnt;
+	return *this;
+}
+
+auto node::subtree_stats::operator-=(const subtree_stats& rhs) -> subtree_stats& {
+	leafs -= std::min(leafs, rhs.leafs);
+	nodes -= std::min(nodes, rhs.nodes);
+	for(const auto& [otid, cnt] : rhs.types) {
+		if(auto ptype = types.find(otid); ptype != types.end()) {
+			if(ptype->second > cnt)
+				ptype->second -= cnt;
+			else
+				types.erase(ptype);
+		}
+	}
+	return *this;
+}
+
 auto node::leafs(Key order) const -> links_v {
+	if(order == Key::AnyOrder) {
+		if(auto S = pimpl()->snapshot())
+			return S->leafs;
+	}
 	return pimpl()->actorf<links_v>(
 		*this, a_node_leafs(), order
 	).value_or(links_v{});
 }
 
+auto node::leafs(Key order, std::size_t offset, std::size_t count) const -> links_v {
+	if(order == Key::AnyOrder) {
+		if(auto S = pimpl()->snapshot())
+			return node_impl::window<Key::AnyOrder>(S->leafs, offset, count).extract_values();
+	}
+	return pimpl()->actorf<links_v>(
+		*this, a_node_leafs(), order, offset, count
+	).value_or(links_v{});
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //  keys
 //
 auto node::keys(Key ordering) const -> lids_v {
+	if(ordering == Key::AnyOrder) {
+		if(auto S = pimpl()->snapshot())
+			return range_t(S->leafs.begin(), S->leafs.end()).extract_keys();
+	}
 	return pimpl()->actorf<lids_v>(
 		*this, a_node_keys(), ordering
 	).value_or(lids_v{});
 }
 
+auto node::keys(Key ordering, std::size_t offset, std::size_t count) const -> lids_v {
+	if(ordering == Key::AnyOrder) {
+		if(auto S = pimpl()->snapshot())
+			return node_impl::window<Key::AnyOrder>(S->leafs, offset, count).extract_keys();
+	}
+	return pimpl()->actorf<lids_v>(
+		*this, a_node_keys(), ordering, offset, count
+	).value_or(lids_v{});
+}
+
+auto node::ikeys(Key ordering, std::size_t offset, std::size_t count) const -> std::vector<std::size_t> {
+	using R = std::vector<std::size_t>;
+	return pimpl()->actorf<R>(
+		*this, a_node_ikeys(), ordering, offset, count
+	).value_or(R{});
+}
+
 auto node::ikeys(Key ordering) const -> std::vector<std::size_t> {
 	using R = std::vector<std::size_t>;
 	return pimpl()->actorf<std::vector<std::size_t>>(
@@ -138,12 +210,19 @@ auto node::skeys(Key key_meaning, Key ordering) const -> std::vector<std::string
 //  find
 //
 auto node::find(std::size_t idx) const -> link {
+	if(auto S = pimpl()->snapshot())
+		return idx < S->leafs.size() ? S->leafs[idx] : link{};
 	return pimpl()->actorf<link>(
 		*this, a_node_find(), idx
 	).value_or(link{});
 }
 
 auto node::find(lid_type id) const -> link {
+	if(auto S = pimpl()->snapshot()) {
+		if(auto idx = S->find(id))
+			return S->leafs[*idx];
+		return {};
+	}
 	return pimpl()->actorf<link>(
 		*this, a_node_find(), std::move(id)
 	).value_or(link{});
@@ -178,6 +257,8 @@ auto node::deep_equal_range(std::string key, Key key_meaning) const -> links_v {
 
 // ---- index
 auto node::index(lid_type lid) const -> existing_index {
+	if(auto S = pimpl()->snapshot())
+		return S->find(lid);
 	return pimpl()->actorf<existing_index>(
 		*this, a_node_index(), std::move(lid)
 	).value_or(existing_index{});
@@ -246,6 +327,16 @@ auto node::erase(std::string key, Key key_meaning) const -> size_t {
 	).value_or(0);
 }
 
+auto node::erase(lids_v r) const -> size_t {
+	return pimpl()->actorf<size_t>(
+		*this, a_node_erase(), std::move(r)
+	).value_or(0);
+}
+
+auto node::erase(launch_async_t, lids_v r) const -> void {
+	caf::anon_send(pimpl()->actor(*this), a_node_erase(), std::move(r), EraseOpts::Deferred);
+}
+
 auto node::clear() const -> std::size_t {
 	return pimpl()->actorf<std::size_t>(*this, a_node_clear()).value_or(0);
 }
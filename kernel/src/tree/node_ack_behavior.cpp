@@ -23,8 +23,11 @@ return {
 	[=](a_ack, caf::actor origin, a_node_insert, const lid_type& lid, size_t pos) {
 		adbg(this) << "{a_node_insert ack}: " << pos << std::endl;
 		// notify handle's home about data change (to just trigger event handlers)
-		if(origin == this)
+		if(origin == this) {
 			forward_up_home(a_ack(), a_data(), tr_result::box{});
+			if(auto L = impl.search<Key::ID>(lid))
+				stats_count({L}, true);
+		}
 		forward_up(a_ack(), std::move(origin), a_node_insert(), lid, pos);
 
 		//if(origin != this) {
@@ -50,6 +53,22 @@ return {
 		//}
 	},
 
+	// ack on bulk insert
+	[=](a_ack, caf::actor origin, a_node_insert, lids_v lids, std::vector<std::size_t> pos) {
+		adbg(this) << "{a_node_insert ack} [bulk]: " << lids.size() << " leafs" << std::endl;
+		// notify handle's home about data change (to just trigger event handlers)
+		if(origin == this) {
+			forward_up_home(a_ack(), a_data(), tr_result::box{});
+			auto inserted = links_v{};
+			inserted.reserve(lids.size());
+			for(const auto& lid : lids)
+				if(auto L = impl.search<Key::ID>(lid))
+					inserted.push_back(std::move(L));
+			stats_count(inserted, true);
+		}
+		forward_up(a_ack(), std::move(origin), a_node_insert(), std::move(lids), std::move(pos));
+	},
+
 	// ack on erase
 	[=](a_ack, caf::actor origin, a_node_erase, lids_v lids) {
 		adbg(this) << "{a_node_erase ack}" << std::endl;
@@ -63,6 +82,12 @@ return {
 		//}
 	},
 
+	// stats delta of nested subtree
+	[=](a_ack, caf::actor, a_node_stats, const node::subtree_stats& delta, bool add) {
+		adbg(this) << "{a_node_stats ack}" << std::endl;
+		stats_update(delta, add);
+	},
+
 	// handle my leaf rename
 	[=](a_ack, const lid_type& lid, a_lnk_rename, std::string new_, std::string old_) {
 		adbg(this) << "{a_lnk_rename ack}" << std::endl;
@@ -72,10 +97,17 @@ return {
 	},
 	// track my leaf status
 	[=](a_ack, const lid_type& lid, a_lnk_status, Req req, ReqStatus new_, ReqStatus old_) {
+		// pointee can change after data is loaded
+		if(req == Req::Data && new_ == ReqStatus::OK && new_ != old_)
+			extraidx_refresh(lid);
+		// leaf's type & subtree are counted in stats after data is loaded
+		if(new_ == ReqStatus::OK && new_ != old_)
+			stats_refresh(lid);
 		ack_up(lid, a_lnk_status(), req, new_, old_);
 	},
 	// my leafs data change
 	[=](a_ack, const lid_type& lid, a_data, tr_result::box tres) {
+		extraidx_refresh(lid);
 		ack_up(lid, a_data(), std::move(tres));
 	},
 
@@ -9,10 +9,13 @@
 
 #include "node_actor.h"
 #include "node_extraidx_actor.h"
+#include "shard_executor.h"
 #include "link_impl.h"
+#include "tree_impl.h"
 #include "../serialize/tree_impl.h"
 
 #include <bs/log.h>
+#include <bs/kernel/config.h>
 #include <bs/tree/tree.h>
 
 #include <caf/typed_event_based_actor.hpp>
@@ -31,10 +34,9 @@ using namespace std::string_literals;
 
 [[maybe_unused]] auto adbg_impl(caf::actor_ostream res, const node_impl& N) -> caf::actor_ostream {
 	res << "[N] ";
-	if(auto pgrp = N.home.get())
-		res << "[" << pgrp->identifier() << "]";
-	else
-		res << "[homeless]";
+	res << "[" << N.home_id() << "]";
+	if(!N.existing_home())
+		res << " [homeless]";
 	res <<  ": ";
 	return res;
 }
@@ -55,22 +57,23 @@ auto node_actor::rename(std::vector<iterator<Key::Name>> namesakes, const std::s
 		auto pos = work.back();
 		work.pop_back();
 		// [NOTE] use `await` to ensure node is not modified while link is renaming
-		request(
-			pos->actor(), kernel::radio::timeout(), a_apply(),
+		detail::request_apply(
+			this, *pos,
 			link_transaction{[=]() -> error {
 				adbg(this) << "-> a_lnk_rename [" << to_string(pos->id()) <<
 					"][" << pos->name(unsafe) << "] -> [" << new_name << "]" << std::endl;
 
 				impl.rename(pos, new_name);
 				return perfect;
-			}}
-		).await(
-			// on success rename next element
-			[=, work = std::move(work)](tr_result::box r) mutable {
-				self(self, std::move(work), tr_result{r}.err().ok() ? cur_res + 1 : cur_res);
-			},
-			// on error deliver number of already renamed leafs
-			[=](const caf::error&) mutable { res.deliver(cur_res); }
+			}},
+			[&](auto rh) { rh.await(
+				// on success rename next element
+				[=, work = std::move(work)](tr_result::box r) mutable {
+					self(self, std::move(work), tr_result{r}.err().ok() ? cur_res + 1 : cur_res);
+				},
+				// on error deliver number of already renamed leafs
+				[=](const caf::error&) mutable { res.deliver(cur_res); }
+			); }
 		);
 	};
 
@@ -90,8 +93,8 @@ auto do_insert(
 ) -> caf::result<node::insert_status> {
 	// insert atomically for both node & link
 	auto res = self->make_response_promise<node::insert_status>();
-	self->request(
-		L.actor(), kernel::radio::timeout(), a_apply(),
+	detail::request_apply(
+		self, L,
 		link_transaction([=, pp = std::move(pp)]() mutable -> error {
 			adbg(self) << "-> a_node_insert [L][" << to_string(L.id()) <<
 				"][" << L.name(unsafe) << "]" << std::endl;
@@ -104,21 +107,24 @@ auto do_insert(
 				return er;
 			// report success if insertion happened
 			return ir.second;
-		})
-	).await(
-		[=, aw = std::move(aw)](tr_result::box trb) mutable {
-			auto tres = tr_result{std::move(trb)};
-			if(tres.err())
+		}),
+		[&](auto rh) { rh.await(
+			[=, aw = std::move(aw)](tr_result::box trb) mutable {
+				auto tres = tr_result{std::move(trb)};
+				if(tres.err())
+					res.deliver(node::insert_status{{}, false});
+				// fetch OID & type keys of inserted link
+				self->extraidx_fetch();
+				aw(std::move(tres));
+			},
+			// on error forward caf error to await handler
+			[=, Lid = L.id()](const caf::error& er) mutable {
 				res.deliver(node::insert_status{{}, false});
-			aw(std::move(tres));
-		},
-		// on error forward caf error to await handler
-		[=, Lid = L.id()](const caf::error& er) mutable {
-			res.deliver(node::insert_status{{}, false});
-			aw(forward_caf_error(
-				er, "in node["s + std::string(self->impl.home_id()) + "] insert link[" + to_string(Lid) + ']'
-			));
-		}
+				aw(forward_caf_error(
+					er, "in node["s + std::string(self->impl.home_id()) + "] insert link[" + to_string(Lid) + ']'
+				));
+			}
+		); }
 	);
 	return res;
 }
@@ -136,22 +142,155 @@ auto notify_after_insert(node_actor* self) {
 	};
 }
 
-auto on_erase(const link& L, node_actor& self) {
-	// collect link IDs of all deleted subtree elements
-	// first elem is erased link itself
-	lids_v lids{ L.id() };
-	walk(L, [&lids](const link&, const std::list<link>& Ns, const links_v& Os) {
-		const auto dump_erased = [&](const link& erl) {
-			lids.push_back(erl.id());
-		};
-		std::for_each(Ns.begin(), Ns.end(), dump_erased);
-		std::for_each(Os.begin(), Os.end(), dump_erased);
-	});
+// collect link IDs of all deleted subtree elements in single walk
+// first elems are erased links themselves
+auto collect_erased(const links_v& erased) -> lids_v {
+	auto lids = range_t(erased.begin(), erased.end()).extract_keys();
+	detail::walk(
+		{erased.begin(), erased.end()},
+		[&lids](const link&, const std::list<link>& Ns, const links_v& Os) {
+			const auto dump_erased = [&](const link& erl) {
+				lids.push_back(erl.id());
+			};
+			std::for_each(Ns.begin(), Ns.end(), dump_erased);
+			std::for_each(Os.begin(), Os.end(), dump_erased);
+		}
+	);
+	return lids;
+}
+
+auto on_erase(node_actor* self, links_v erased, EraseOpts opts) {
+	if(erased.empty() || enumval(opts & EraseOpts::Silent)) return;
 
-	// send message that link erased
-	self.impl.send_home<high_prio>(
-		&self, a_ack(), &self, a_node_erase(), std::move(lids)
+	if(enumval(opts & EraseOpts::Deferred)) {
+		// erased links are already detached from node, so walk them in background thread
+		auto collector = self->spawn<caf::detached>([](caf::event_based_actor* worker) -> caf::behavior {
+			return {
+				[=](const links_v& erased) {
+					worker->quit();
+					return collect_erased(erased);
+				}
+			};
+		});
+		// [NOTE] node awaits collected IDs and sends ack itself, so ack isn't overtaken by
+		// next acks of this node
+		self->request(collector, caf::infinite, std::move(erased)).await(
+			[=](lids_v lids) {
+				self->impl.send_home<high_prio>(self, a_ack(), self, a_node_erase(), std::move(lids));
+			},
+			[=](const caf::error& er) {
+				adbg(self) << "<- a_node_erase [deferred] failed: " << to_string(er) << std::endl;
+			}
+		);
+	}
+	else
+		// send single message about all erased links
+		self->impl.send_home<high_prio>(
+			self, a_ack(), self, a_node_erase(), collect_erased(erased)
+		);
+}
+
+// obtain leafs sorted by extra index via `extraidx_search_actor` & deliver processed window of them
+template<typename R, typename F>
+auto extraidx_window(node_actor* self, Key order, std::size_t offset, std::size_t count, F f)
+-> caf::result<R> {
+	self->extraidx_demand();
+	auto rp = self->make_response_promise<R>();
+	self->request(
+		self->system().spawn(extraidx_search_actor), kernel::radio::timeout(true),
+		a_node_leafs(), order, self->impl.leafs(Key::AnyOrder)
+	).then(
+		[=](const links_v& leafs) mutable {
+			rp.deliver(f(node_impl::window<Key::AnyOrder>(leafs, offset, count)));
+		},
+		[=](const caf::error& er) mutable { rp.deliver(er); }
 	);
+	return rp;
+}
+
+// invoke erase op that accepts leafs postprocessing function & notify about erased leafs
+template<typename F>
+auto do_erase(node_actor* self, EraseOpts opts, F erase_op) -> std::size_t {
+	// [NOTE] config is read once
+	static const bool deferred_erase = get_or(kernel::config::config(), "tree.deferred_erase", false);
+	if(deferred_erase)
+		opts |= EraseOpts::Deferred;
+
+	auto erased = links_v{};
+	std::size_t res = 0;
+	error::eval_safe([&] {
+		res = erase_op([&](const link& L) { erased.push_back(L); });
+	});
+	self->stats_count(erased, false);
+	on_erase(self, std::move(erased), opts);
+	return res;
+}
+
+// object type & owned subtree of leaf that it's counted with in stats
+// [NOTE] sym links aren't resolved to not block node actor, so they're counted as untyped leafs
+auto make_stats_leaf(const link& L) -> std::pair<node_impl::stats_leaf, node> {
+	auto res = std::pair{node_impl::stats_leaf{nil_otid, false}, node::nil()};
+	if(L.type_id() == sym_link::type_id_()) return res;
+	if(auto obj = L.data(unsafe))
+		res.first.otid = obj->type_id();
+	// count only subtrees owned by leaf
+	if(auto N = L.data_node(unsafe); N && N.handle() == L) {
+		res.first.is_node = true;
+		res.second = std::move(N);
+	}
+	return res;
+}
+
+// count local part of given leafs & request stats of nested subtrees
+// `on_child(const subtree_stats*)` is invoked for each nested subtree, nullptr is passed on error
+template<typename F>
+auto count_leafs(node_actor* self, const links_v& leafs, bool add, F on_child) -> node::subtree_stats {
+	auto& counted = self->impl.stats_leafs_;
+	auto res = node::subtree_stats{};
+	for(const auto& L : leafs) {
+		auto [leaf, N] = make_stats_leaf(L);
+		if(add) {
+			// every leaf is counted once, even if it's insert ack comes after stats are built
+			if(!counted.try_emplace(L.id(), leaf).second) continue;
+		}
+		else {
+			// erased leafs are subtracted with values they were counted with
+			auto pleaf = counted.find(L.id());
+			if(pleaf == counted.end()) continue;
+			leaf = std::move(pleaf->second);
+			counted.erase(pleaf);
+		}
+
+		++res.leafs;
+		++res.types[leaf.otid];
+		if(!leaf.is_node) continue;
+		++res.nodes;
+		if(!N) {
+			on_child(nullptr);
+			continue;
+		}
+		self->request(node_impl::actor(N), kernel::radio::timeout(true), a_node_stats())
+		.then(
+			[=](const node::subtree_stats& sub) mutable { on_child(&sub); },
+			[=](const caf::error&) mutable { on_child(nullptr); }
+		);
+	}
+	return res;
+}
+
+// deliver complete stats to waiting requests
+auto stats_deliver(node_actor* self) -> void {
+	auto& impl = self->impl;
+	if(impl.stats_pending_ || !impl.stats_) return;
+	auto waiters = std::move(impl.stats_waiters_);
+	for(auto& rp : waiters)
+		rp.deliver(*impl.stats_);
+	// if maintance is disabled, stats are counted from scratch on every request
+	static const bool maintain_stats = get_or(kernel::config::config(), "tree.subtree_stats", true);
+	if(!maintain_stats) {
+		impl.stats_.reset();
+		impl.stats_leafs_.clear();
+	}
 }
 
 NAMESPACE_END()
@@ -173,6 +312,7 @@ auto node_actor::insert(link L, std::size_t to_idx, InsertPolicy pol) -> caf::re
 		auto to = std::next(impl.begin(), to_idx);
 		// noop if to == from
 		impl.links_.get<Key_tag<Key::AnyOrder>>().relocate(to, from);
+		impl.snapshot_reset();
 
 		// detect move and send proper message
 		if(is_inserted) // normal insert
@@ -188,47 +328,148 @@ auto node_actor::insert(link L, std::size_t to_idx, InsertPolicy pol) -> caf::re
 }
 
 auto node_actor::insert(links_v Ls, InsertPolicy pol) -> caf::result<std::size_t> {
-	auto res = make_response_promise<std::size_t>();
-	auto insert_many = [=](auto&& self, auto work, size_t cur_res) mutable {
-		if(work.empty()) {
-			res.deliver(cur_res);
-			return;
-		}
-
-		auto L = work.back();
-		work.pop_back();
-		do_insert(
-			this, L, pol, notify_after_insert(this),
-			[=, work = std::move(work)](const tr_result& tres) mutable {
-				if(tres.err()) {
-					// if CAF error happens, stop insertion & deliver result
-					// otherwise just not increment inserted leafs counter
-					if(tres.err().code.category().name() == "CAF"s) {
-						res.deliver(cur_res);
-						return;
-					}
-				}
-				else
-					cur_res += 1;
-				// recurse to next element
-				self(self, std::move(work), cur_res);
-			}
+	// validate, claim & insert all links in one step inside node actor
+	// [NOTE] link-side updates (owner, handle, rename on dup) are guarded by link's own lock,
+	// same as when link is erased
+	auto lids = lids_v{};
+	auto positions = std::vector<std::size_t>{};
+	lids.reserve(Ls.size());
+	positions.reserve(Ls.size());
+	for(const auto& L : Ls) {
+		adbg(this) << "-> a_node_insert [bulk] [L][" << to_string(L.id()) <<
+			"][" << L.name(unsafe) << "]" << std::endl;
+		auto ir = insert_status<Key::ID>{};
+		if(auto er = error::eval_safe([&] { ir = impl.insert(L, pol); }); er || !ir.second)
+			continue;
+		// positions can be non-contiguous if some links were merged or denied by policy
+		lids.push_back(L.id());
+		positions.push_back(*impl.index<Key::ID>(ir.first));
+	}
+
+	// fetch OID & type keys of inserted links
+	extraidx_fetch();
+	// send single ack for all inserted links
+	const auto n = lids.size();
+	if(n)
+		impl.send_home<high_prio>(
+			this, a_ack(), this, a_node_insert(), std::move(lids), std::move(positions)
 		);
+	return n;
+}
+
+auto node_actor::erase(const lid_type& victim, EraseOpts opts) -> size_t {
+	return do_erase(this, opts, [&](auto ppf) { return impl.erase<Key::ID>(victim, ppf); });
+}
+
+auto node_actor::erase(const lids_v& victims, EraseOpts opts) -> size_t {
+	return do_erase(this, opts, [&](auto ppf) { return impl.erase(victims, ppf); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  OID & object type indexes
+//
+auto node_actor::extraidx_demand() -> void {
+	if(!impl.extraidx_ && get_or(kernel::config::config(), "tree.node_extraidx", true))
+		impl.extraidx_enable();
+	extraidx_fetch();
+}
+
+auto node_actor::extraidx_fetch() -> void {
+	if(!impl.extraidx_ || impl.extraidx_queue_.empty()) return;
+
+	auto work = links_v{};
+	std::swap(work, impl.extraidx_queue_);
+	const auto update = [=](const lid_type& lid, const sp_obj& obj) {
+		if(obj)
+			impl.extraidx_update(lid, obj->id(), obj->type_id());
+		else
+			impl.extraidx_update(lid, nil_oid, nil_otid);
 	};
 
-	std::reverse(Ls.begin(), Ls.end());
-	insert_many(insert_many, std::move(Ls), 0);
-	return res;
+	for(auto& L : work) {
+		const auto lid = L.id();
+		++impl.extraidx_pending_[lid];
+		// object is read directly from link (doesn't spawn it's actor), except sym links
+		// that resolve target & can query this node
+		if(L.type_id() != sym_link::type_id_()) {
+			update(lid, L.data(unsafe));
+			continue;
+		}
+		// [NOTE] use `then` (not `await`), because sym link can query this node while resolving target
+		request(L.actor(), kernel::radio::timeout(), a_data(), false)
+		.then(
+			[=](obj_or_errbox obj) { update(lid, obj ? *obj : nullptr); },
+			[=](const caf::error&) { update(lid, nullptr); }
+		);
+	}
 }
 
-auto node_actor::erase(const lid_type& victim, EraseOpts opts) -> size_t {
-	const auto ppf = [=](const link& L) { on_erase(L, *this); };
-	std::size_t res = 0;
-	error::eval_safe([&] { res = impl.erase<Key::ID>(
-		victim,
-		enumval(opts & EraseOpts::Silent) ? noop : function_view{ ppf }
-	); });
-	return res;
+auto node_actor::extraidx_refresh(const lid_type& lid) -> void {
+	if(!impl.extraidx_) return;
+	if(auto L = impl.search<Key::ID>(lid)) {
+		impl.extraidx_touch(L);
+		extraidx_fetch();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  aggregate subtree stats
+//
+auto node_actor::stats_demand() -> caf::result<node::subtree_stats> {
+	if(!impl.stats_) {
+		impl.stats_.emplace();
+		// guard prevents delivery until all child requests are sent
+		impl.stats_pending_ = 1;
+		const auto on_child = [=](const node::subtree_stats* sub) {
+			if(sub && impl.stats_) *impl.stats_ += *sub;
+			--impl.stats_pending_;
+			stats_deliver(this);
+		};
+		*impl.stats_ += count_leafs(this, impl.values<Key::AnyOrder>(), true, on_child);
+		on_child(nullptr);
+	}
+	// subtree stats are ready
+	if(!impl.stats_pending_) {
+		auto res = *impl.stats_;
+		stats_deliver(this);
+		return res;
+	}
+	// wait until nested subtrees are counted
+	auto rp = make_response_promise<node::subtree_stats>();
+	impl.stats_waiters_.push_back(rp);
+	return rp;
+}
+
+auto node_actor::stats_count(const links_v& leafs, bool add) -> void {
+	if(!impl.stats_ || leafs.empty()) return;
+	stats_update(count_leafs(this, leafs, add, [=](const node::subtree_stats* sub) {
+		if(sub) stats_update(*sub, add);
+	}), add);
+}
+
+auto node_actor::stats_update(const node::subtree_stats& delta, bool add) -> void {
+	if(!impl.stats_) return;
+	if(add)
+		*impl.stats_ += delta;
+	else
+		*impl.stats_ -= delta;
+	// while stats are being built, upper level waits for complete stats instead of deltas
+	if(!impl.stats_pending_)
+		ack_up(a_node_stats(), delta, add);
+}
+
+auto node_actor::stats_refresh(const lid_type& lid) -> void {
+	if(!impl.stats_) return;
+	auto L = impl.search<Key::ID>(lid);
+	if(!L) return;
+	// recount leaf only if it's type or subtree presence was actually changed
+	if(auto pleaf = impl.stats_leafs_.find(lid); pleaf != impl.stats_leafs_.end()) {
+		const auto leaf = make_stats_leaf(L).first;
+		if(pleaf->second.otid == leaf.otid && pleaf->second.is_node == leaf.is_node) return;
+	}
+	const auto leafs = links_v{std::move(L)};
+	stats_count(leafs, false);
+	stats_count(leafs, true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -262,41 +503,75 @@ return {
 	// subscribe events listener
 	[=](a_subscribe, const caf::actor& baby) {
 		// remember baby & ensure it's alive
-		return delegate(caf::actor_cast<ev_listener_actor_type>(baby), a_hi(), impl.home);
+		return delegate(caf::actor_cast<ev_listener_actor_type>(baby), a_hi(), impl.home());
 	},
 
-	// unconditionally join home group - used after deserialization
-	[=](a_hi) { join(impl.home); },
-
-	[=](a_home) { return impl.home; },
+	[=](a_home) { return impl.home(); },
 
 	[=](a_home_id) { return std::string(impl.home_id()); },
 
 	[=](a_node_handle) { return impl.handle(); },
 
-	[=](a_node_size) { return impl.size(); },
+	// direct reads missed snapshot => publish it, so next reads are served without messaging
+	[=](a_node_size) { return impl.snapshot_publish()->leafs.size(); },
 
 	[=](a_node_leafs, Key order) -> caf::result<links_v> {
 		adbg(this) << "{a_node_leafs} " << static_cast<int>(order) << std::endl;
-		if(has_builtin_index(order))
+		// full leafs copy is O(n) anyway, so publish snapshot for subsequent direct reads
+		if(order == Key::AnyOrder)
+			return impl.snapshot_publish()->leafs;
+		if(impl.has_index(order))
 			return impl.leafs(order);
+		extraidx_demand();
 		return delegate(spawn(extraidx_search_actor), a_node_leafs(), order, impl.leafs(Key::AnyOrder));
 	},
 
+	// paged access
+	[=](a_node_leafs, Key order, std::size_t offset, std::size_t count) -> caf::result<links_v> {
+		if(impl.has_index(order))
+			return impl.leafs(order, offset, count);
+		return extraidx_window<links_v>(
+			this, order, offset, count, [](const auto& w) { return w.extract_values(); }
+		);
+	},
+
+	[=](a_node_keys, Key order, std::size_t offset, std::size_t count) -> caf::result<lids_v> {
+		if(impl.has_index(order))
+			return impl.keys(order, offset, count);
+		return extraidx_window<lids_v>(
+			this, order, offset, count, [](const auto& w) { return w.extract_keys(); }
+		);
+	},
+
+	[=](a_node_ikeys, Key order, std::size_t offset, std::size_t count)
+	-> caf::result<std::vector<std::size_t>> {
+		if(impl.has_index(order))
+			return impl.ikeys(order, offset, count);
+		return extraidx_window<std::vector<std::size_t>>(
+			this, order, offset, count, [=](const auto& w) { return impl.ikeys(w.begin(), w.end()); }
+		);
+	},
+
 	[=](a_node_keys, Key order) -> caf::result<lids_v> {
-		// builtin indexes can be processed directly
-		if(has_builtin_index(order))
+		if(order == Key::AnyOrder) {
+			const auto& Ls = impl.snapshot_publish()->leafs;
+			return range_t(Ls.begin(), Ls.end()).extract_keys();
+		}
+		// builtin & ready extra indexes can be processed directly
+		if(impl.has_index(order))
 			return impl.keys(order);
 		// others via extra index actor
+		extraidx_demand();
 		return delegate(spawn(extraidx_search_actor), a_node_keys(), order, impl.leafs(Key::AnyOrder));
 	},
 
 	[=](a_node_ikeys, Key order) -> caf::result<std::vector<std::size_t>> {
-		// builtin indexes can be processed directly
-		if(has_builtin_index(order))
+		// builtin & ready extra indexes can be processed directly
+		if(impl.has_index(order))
 			return impl.ikeys(order);
 
 		// others via extra sorted leafs
+		extraidx_demand();
 		auto rp = make_response_promise();
 		request(
 			system().spawn(extraidx_search_actor), kernel::radio::timeout(true),
@@ -310,6 +585,9 @@ return {
 	},
 
 	[=](a_node_keys, Key meaning, Key order) -> caf::result<std::vector<std::string>> {
+		if(impl.has_index(meaning) && impl.has_index(order))
+			return impl.skeys(meaning, order);
+		extraidx_demand();
 		return delegate(
 			spawn(extraidx_search_actor), a_node_keys(), meaning, order, impl.leafs(Key::AnyOrder)
 		);
@@ -318,24 +596,27 @@ return {
 	// find
 	[=](a_node_find, const lid_type& lid) -> link {
 		adbg(this) << "-> a_node_find lid " << to_string(lid) << std::endl;
-		auto res = impl.search<Key::ID>(lid);
-		return res;
+		const auto S = impl.snapshot_publish();
+		if(auto idx = S->find(lid))
+			return S->leafs[*idx];
+		return {};
 	},
 
 	[=](a_node_find, std::size_t idx) -> link {
 		adbg(this) << "-> a_node_find idx " << idx << std::endl;
-		return impl.search<Key::AnyOrder>(idx);
+		const auto S = impl.snapshot_publish();
+		return idx < S->leafs.size() ? S->leafs[idx] : link{};
 	},
 
 	[=](a_node_find, std::string key, Key key_meaning) -> caf::result<link> {
 		adbg(this) << "-> a_node_find key " << key << std::endl;
-		if(has_builtin_index(key_meaning))
+		if(impl.has_index(key_meaning))
 			return impl.search(key, key_meaning);
-		else
-			return delegate(
-				spawn(extraidx_search_actor),
-				a_node_find(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
-			);
+		extraidx_demand();
+		return delegate(
+			spawn(extraidx_search_actor),
+			a_node_find(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
+		);
 	},
 
 	// deep search
@@ -374,28 +655,28 @@ return {
 
 	// index
 	[=](a_node_index, const lid_type& lid) -> existing_index {
-		return impl.index<Key::ID>(lid);
+		return impl.snapshot_publish()->find(lid);
 	},
 
 	[=](a_node_index, std::string key, Key key_meaning) -> caf::result<existing_index> {
-		if(has_builtin_index(key_meaning))
+		if(impl.has_index(key_meaning))
 			return impl.index(key, key_meaning);
-		else
-			return delegate(
-				system().spawn(extraidx_search_actor),
-				a_node_index(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
-			);
+		extraidx_demand();
+		return delegate(
+			system().spawn(extraidx_search_actor),
+			a_node_index(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
+		);
 	},
 
 	// equal_range
 	[=](a_node_equal_range, std::string key, Key key_meaning) -> caf::result<links_v> {
-		if(has_builtin_index(key_meaning))
+		if(impl.has_index(key_meaning))
 			return impl.equal_range(key, key_meaning);
-		else
-			return delegate(
-				system().spawn(extraidx_search_actor),
-				a_node_equal_range(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
-			);
+		extraidx_demand();
+		return delegate(
+			system().spawn(extraidx_search_actor),
+			a_node_equal_range(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
+		);
 	},
 
 	// insert new link
@@ -420,39 +701,40 @@ return {
 
 	// all other erase overloads do normal erase
 	[=](a_node_erase, std::size_t idx) {
-		return impl.erase<Key::AnyOrder>(
-			idx, [=](const link& L) { on_erase(L, *this); }
-		);
+		return do_erase(this, EraseOpts::Normal, [&](auto ppf) {
+			return impl.erase<Key::AnyOrder>(idx, ppf);
+		});
 	},
 
 	[=](a_node_erase, std::string key, Key key_meaning) -> caf::result<std::size_t>{
-		if(has_builtin_index(key_meaning)) {
-			auto res = std::size_t{};
-			error::eval_safe([&] {
-				res = impl.erase(
-					key, key_meaning, [=](const link& L) { on_erase(L, *this); }
-				);
+		if(impl.has_index(key_meaning)) {
+			return do_erase(this, EraseOpts::Normal, [&](auto ppf) {
+				return impl.erase(key, key_meaning, ppf);
 			});
-			return res;
 		}
-		else
-			return delegate(
-				system().spawn(extraidx_erase_actor, actor()),
-				a_node_erase(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
-			);
+		extraidx_demand();
+		return delegate(
+			system().spawn(extraidx_erase_actor, actor()),
+			a_node_erase(), std::move(key), key_meaning, impl.values<Key::AnyOrder>()
+		);
 	},
 
 	// erase bunch of links
-	[=](a_node_erase, const lids_v& lids) {
-		return impl.erase(
-			lids, [=](const link& L) { on_erase(L, *this); }
-		);
+	[=](a_node_erase, const lids_v& lids) -> std::size_t {
+		return erase(lids);
 	},
 
 	[=](a_node_clear) -> std::size_t {
-		auto res = impl.links_.size();
-		impl.links_.clear();
-		return res;
+		// all leafs are dropped at once, so subtract complete stats
+		if(impl.stats_) {
+			stats_update(node::subtree_stats{*impl.stats_}, false);
+			impl.stats_leafs_.clear();
+		}
+		return impl.clear();
+	},
+
+	[=](a_node_stats) -> caf::result<node::subtree_stats> {
+		return stats_demand();
 	},
 
 	// rename
@@ -482,6 +764,11 @@ return {
 	[=](a_node_erase, const lid_type& lid, EraseOpts opts) -> std::size_t {
 		return erase(lid, opts);
 	},
+
+	// erase bunch of links with specified options
+	[=](a_node_erase, const lids_v& lids, EraseOpts opts) -> std::size_t {
+		return erase(lids, opts);
+	},
 }; }
 
 auto node_actor::make_behavior() -> behavior_type {
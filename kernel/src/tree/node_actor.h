@@ -30,17 +30,20 @@ public:
 	// pass message to upper (owner) level of tree structure
 	template<typename... Args>
 	auto forward_up(Args&&... args) -> void {
+		// skip events that nobody listens to up the tree
+		if constexpr(constexpr auto ev = node_impl::ack_event<Args...>(); ev != Event::Nil) {
+			if(!impl.upstream_listens(ev)) return;
+		}
 		// node forward messages to handle's actor
 		if(auto h = impl.handle())
 			send(link_impl::actor(h), std::forward<Args>(args)...);
 	}
 
-	// pass message exactly to home group of owning handle link
+	// pass message exactly to home of owning handle link
 	template<typename... Args>
 	auto forward_up_home(Args&&... args) -> void {
-		// node forward messages to handle's actor
 		if(auto h = impl.handle())
-			checked_send<link_impl::home_actor_type>(*this, h.home(), std::forward<Args>(args)...);
+			impl.send_home_of(*this, h, std::forward<Args>(args)...);
 	}
 
 	// forward 'ack' message to upper level, auto prepend it with this node actor handle
@@ -75,13 +78,37 @@ public:
 	auto insert(links_v Ls, InsertPolicy pol) -> caf::result<std::size_t>;
 
 	auto erase(const lid_type& key, EraseOpts opts = EraseOpts::Normal) -> size_t;
+
+	// erase multiple leafs & send single ack with IDs of all erased subtree elements
+	auto erase(const lids_v& victims, EraseOpts opts = EraseOpts::Normal) -> size_t;
+
+	///////////////////////////////////////////////////////////////////////////////
+	//  OID & object type indexes maintance
+	//
+	// build extra indexes if they're enabled in config & not yet started
+	auto extraidx_demand() -> void;
+	// request fresh keys for leafs queued in impl
+	auto extraidx_fetch() -> void;
+	// refetch keys of leaf with given ID
+	auto extraidx_refresh(const lid_type& lid) -> void;
+
+	///////////////////////////////////////////////////////////////////////////////
+	//  aggregate subtree stats maintance
+	//
+	// start maintaining stats & return them after all nested subtrees are counted
+	auto stats_demand() -> caf::result<node::subtree_stats>;
+	// count given leafs (with nested subtrees) as inserted (`add` = true) or erased
+	auto stats_count(const links_v& leafs, bool add) -> void;
+	// apply delta to stats & pass it to upper level
+	auto stats_update(const node::subtree_stats& delta, bool add) -> void;
+	// recount leaf with given ID after it's data is loaded
+	auto stats_refresh(const lid_type& lid) -> void;
 };
 
-// helper for correct spawn of node actor
+// helper for correct spawn of node actor, home group is created later on demand
 template<typename Actor = node_actor, caf::spawn_options Os = caf::no_spawn_options, class... Ts>
-inline auto spawn_nactor(std::shared_ptr<node_impl> nimpl, caf::group nhome, Ts&&... args) {
-	auto& AS = kernel::radio::system();
-	return AS.spawn_in_group<Actor, Os>(nhome, nhome, std::move(nimpl), std::forward<Ts>(args)...);
+inline auto spawn_nactor(std::shared_ptr<node_impl> nimpl, Ts&&... args) {
+	return kernel::radio::system().spawn<Actor, Os>(std::move(nimpl), std::forward<Ts>(args)...);
 }
 
 NAMESPACE_END(blue_sky::tree)
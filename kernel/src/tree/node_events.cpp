@@ -15,9 +15,13 @@
 NAMESPACE_BEGIN(blue_sky::tree)
 using event_handler = node::event_handler;
 
-static auto make_listener(const node& origin, event_handler f, Event listen_to) {
+static auto make_listener(
+	const node& origin, event_handler f, Event listen_to, event_batch_opts batch, TreeOpts opts,
+	event_queue_opts queue
+) {
 	using namespace kernel::radio;
 	using namespace allow_enumops;
+	const bool deep = enumval(opts & TreeOpts::Deep);
 	using baby_t = ev_listener_actor<node>;
 
 	static const auto handler_impl = [](
@@ -25,18 +29,41 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 	) {
 		if(auto r = weak_root.lock()) {
 			if(!origin) origin = caf::actor_cast<caf::actor>(r.actor());
-			self->f(std::move(r), {std::move(origin), std::move(params), ev});
+			auto E = event{std::move(origin), std::move(params), ev};
+			if(!self->enqueue(E)) self->f(std::move(r), std::move(E));
 		}
 		else // if root source is dead, quit
 			self->quit();
 	};
 
-	auto make_ev_character = [weak_root = node::weak_ptr(origin), listen_to](baby_t* self) {
+	auto make_ev_character = [weak_root = node::weak_ptr(origin), listen_to, deep](baby_t* self) {
+		// let root node know which events to broadcast
+		if(auto r = weak_root.lock())
+			node_impl::register_listener(r, self, listen_to, deep);
+
+		// check if event comes from subtree and must be skipped
+		const auto skip_deep = [=](const caf::actor& src) {
+			return !deep && src.address() != self->origin;
+		};
+
+		// batched events are delivered on behalf of root node
+		self->batch_sink = [=](Event ev, prop::propdict params) {
+			handler_impl(self, weak_root, {}, ev, std::move(params));
+		};
+		// queued events are delivered if root node is still alive
+		self->make_queue_sink = [=](event_handler cb) -> event_queue::sink_f {
+			return [cb = std::move(cb), weak_root](event ev) {
+				if(auto r = weak_root.lock())
+					cb(std::move(r), std::move(ev));
+			};
+		};
+
 		auto res = caf::message_handler{};
 		if(enumval(listen_to & Event::LinkRenamed)) {
 			const auto renamed_impl = [=](
 				caf::actor origin, auto& lid, auto& new_name, auto& old_name
 			) {
+				if(self->coalesce(Event::LinkRenamed, lid)) return;
 				//bsout() << "*-* node: fired LinkRenamed event" << bs_end;
 				handler_impl(self, weak_root, std::move(origin), Event::LinkRenamed, {
 					{"link_id", lid},
@@ -58,6 +85,7 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 					a_ack, caf::actor src, const lid_type& lid,
 					a_lnk_rename, std::string new_name, std::string old_name
 				) {
+					if(skip_deep(src)) return;
 					renamed_impl(std::move(src), lid, new_name, old_name);
 				}
 			);
@@ -67,6 +95,7 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 			const auto status_impl = [=](
 				caf::actor origin, auto& lid, auto req, auto new_s, auto prev_s
 			) {
+				if(self->coalesce(lid, req, new_s, prev_s)) return;
 				//bsout() << "*-* node: fired LinkStatusChanged event" << bs_end;
 				handler_impl(self, weak_root, std::move(origin), Event::LinkStatusChanged, {
 					{"link_id", lid},
@@ -90,6 +119,7 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 					a_ack, caf::actor src, const lid_type& lid,
 					a_lnk_status, Req req, ReqStatus new_s, ReqStatus prev_s
 				) {
+					if(skip_deep(src)) return;
 					status_impl(std::move(src), lid, req, new_s, prev_s);
 				}
 			);
@@ -99,6 +129,7 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 			const auto datamod_impl = [=](
 				caf::actor origin, auto& lid, tr_result::box&& tres_box
 			) {
+				if(self->coalesce(Event::DataModified, lid)) return;
 				//bsout() << "*-* node: fired DataModified event" << bs_end;
 				auto params = prop::propdict{{ "link_id", lid }};
 				if(auto tres = tr_result{std::move(tres_box)})
@@ -116,6 +147,7 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 
 				// deeper subtree leaf status changed
 				[=](a_ack, caf::actor src, const lid_type& lid, a_data, tr_result::box trbox) {
+					if(skip_deep(src)) return;
 					datamod_impl(std::move(src), lid, std::move(trbox));
 				}
 			);
@@ -128,6 +160,8 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 					a_ack, caf::actor src, a_node_insert,
 					const lid_type& lid, std::size_t pos
 				) {
+					if(skip_deep(src)) return;
+					if(self->coalesce(Event::LinkInserted, lid)) return;
 					//bsout() << "*-* node: fired LinkInserted event" << bs_end;
 					handler_impl(self, weak_root, std::move(src), Event::LinkInserted, {
 						{"link_id", lid},
@@ -140,12 +174,33 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 					a_ack, caf::actor src, a_node_insert,
 					const lid_type& lid, std::size_t to_idx, std::size_t from_idx
 				) {
+					if(skip_deep(src)) return;
+					if(self->coalesce(Event::LinkInserted, lid)) return;
 					//bsout() << "*-* node: fired LinkInserted event (move)" << bs_end;
 					handler_impl(self, weak_root, std::move(src), Event::LinkInserted, {
 						{"link_id", lid},
 						{"to_idx", (prop::integer)to_idx},
 						{"from_idx", (prop::integer)from_idx}
 					});
+				},
+
+				// bulk insert
+				[=](
+					a_ack, caf::actor src, a_node_insert, lids_v lids, std::vector<std::size_t> pos
+				) {
+					if(skip_deep(src)) return;
+					if(self->coalesce(Event::LinkInserted, lids)) return;
+					//bsout() << "*-* node: fired LinkInserted event (bulk)" << bs_end;
+					auto context = prop::propdict{
+						{"positions", prop::list_of<prop::integer>(pos.begin(), pos.end())}
+					};
+					if(!pos.empty())
+						context["pos"] = (prop::integer)pos[0];
+					if(!lids.empty()) {
+						context["link_id"] = lids[0];
+						context["lids"] = std::move(lids);
+					}
+					handler_impl(self, weak_root, std::move(src), Event::LinkInserted, std::move(context));
 				}
 			);
 		}
@@ -155,6 +210,8 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 				[=](
 					a_ack, caf::actor src, a_node_erase, lids_v lids
 				) {
+					if(skip_deep(src)) return;
+					if(self->coalesce(Event::LinkErased, lids)) return;
 					//bsout() << "*-* node: fired LinkErased event" << bs_end;
 					auto context = prop::propdict{};
 					if(!lids.empty()) {
@@ -170,24 +227,29 @@ static auto make_listener(const node& origin, event_handler f, Event listen_to)
 	};
 
 	// make shiny new subscriber actor and place into parent's room
-	return system().spawn<baby_t, caf::lazy_init>(
-		origin.actor().address(), std::move(f), std::move(make_ev_character)
+	return baby_t::spawn(
+		origin.actor().address(), std::move(f), std::move(make_ev_character), batch, queue
 	);
 }
 
-auto node::subscribe(event_handler f, Event listen_to) const -> std::uint64_t {
+auto node::subscribe(
+	event_handler f, Event listen_to, event_batch_opts batch, TreeOpts opts, event_queue_opts queue
+) const -> std::uint64_t {
 	// ensure it has started & properly initialized
 	// throw exception otherwise
 	if(auto res = node_impl::actorf<std::uint64_t>(
-		*this, a_subscribe(), make_listener(*this, std::move(f), listen_to)
+		*this, a_subscribe(), make_listener(*this, std::move(f), listen_to, batch, opts, queue)
 	))
 		return *res;
 	else
 		throw res.error();
 }
 
-auto node::subscribe(launch_async_t, event_handler f, Event listen_to) const -> std::uint64_t {
-	auto baby = make_listener(*this, std::move(f), listen_to);
+auto node::subscribe(
+	launch_async_t, event_handler f, Event listen_to, event_batch_opts batch, TreeOpts opts,
+	event_queue_opts queue
+) const -> std::uint64_t {
+	auto baby = make_listener(*this, std::move(f), listen_to, batch, opts, queue);
 	auto baby_id = baby.id();
 	caf::anon_send(pimpl()->actor(*this), a_subscribe{}, std::move(baby));
 	return baby_id;
@@ -17,6 +17,8 @@
 #include <bs/detail/tuple_utils.h>
 
 #include <algorithm>
+#include <shared_mutex>
+#include <unordered_set>
 
 NAMESPACE_BEGIN(blue_sky::tree)
 using bs_detail::shared;
@@ -76,6 +78,36 @@ auto node_impl::set_handle(const link& new_handle) -> void {
 		handle_ = new_handle;
 	else
 		handle_.reset();
+	// ancestry of whole subtree is changed
+	link_impl::touch_paths();
+	if(auto paths = std::atomic_exchange(&paths_base_, link_impl::sp_abspath_cache{}))
+		paths->expire();
+}
+
+auto node_impl::abspath_base() const -> link_impl::sp_abspath_cache {
+	if(auto res = std::atomic_load(&paths_base_); res && !res->is_expired())
+		return res;
+
+	auto res = std::make_shared<link_impl::abspath_cache>();
+	const auto h = handle();
+	if(h) {
+		// [NOTE] handle without owner is root, root ID is irrelevant => leave paths empty
+		// check is made on obtained paths to be consistent with them
+		const auto hpaths = link_impl::abspath(h);
+		if(hpaths->id_path.size() > 1) {
+			res->id_path = hpaths->id_path;
+			res->name_path = hpaths->name_path;
+		}
+		// base is expired together with handle's paths
+		if(!hpaths->add_child(res)) return res;
+	}
+
+	auto guard = lock(shared);
+	// don't cache paths if handle was changed meanwhile
+	if(handle_.lock() != h) return res;
+	if(auto prev = std::atomic_exchange(&paths_base_, link_impl::sp_abspath_cache{res}); prev && prev != res)
+		prev->expire();
+	return res;
 }
 
 auto node_impl::propagate_owner(const node& super, bool deep) -> void {
@@ -109,21 +141,103 @@ auto node_impl::propagate_owner(const node& super, bool deep) -> void {
 }
 
 auto node_impl::spawn_actor(sp_nimpl nimpl) -> caf::actor {
-	// if home group is already started (for ex. by deserializer), then use it
-	// otherwise obtain new group with UUID
-	auto ngrp = nimpl->home ? nimpl->home : system().groups().get_local(to_string(gen_uuid()));
-	return spawn_nactor(std::move(nimpl), std::move(ngrp));
+	return spawn_nactor(std::move(nimpl));
+}
+
+auto node_impl::deep_demand() const -> Event {
+	using namespace allow_enumops;
+	const auto cur_listeners = listeners_epoch();
+	const auto cur_paths = link_impl::paths_epoch();
+	{
+		auto guard = std::shared_lock{demand_guard_};
+		if(demand_ && demand_->listeners_epoch == cur_listeners && demand_->paths_epoch == cur_paths)
+			return demand_->mask;
+	}
+
+	// merge own deep listeners with parent's demand (that is also cached)
+	auto mask = deep_listen_mask();
+	if(const auto h = handle()) {
+		if(const auto parent = h.owner())
+			mask |= pimpl(parent).deep_demand();
+	}
+	auto guard = std::unique_lock{demand_guard_};
+	demand_ = demand_cache{cur_listeners, cur_paths, mask};
+	return mask;
+}
+
+auto node_impl::deep_listens(Event ev) const -> bool {
+	using namespace allow_enumops;
+	return enumval(deep_demand() & ev);
+}
+
+auto node_impl::upstream_listens(Event ev) const -> bool {
+	if(const auto h = handle()) {
+		if(const auto parent = h.owner())
+			return pimpl(parent).deep_listens(ev);
+	}
+	return false;
 }
 
 auto node_impl::size() const -> std::size_t {
 	return links_.size();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+//  snapshots
+//
+auto node_impl::snapshot() const -> sp_node_snapshot {
+	return std::atomic_load(&snapshot_);
+}
+
+auto node_impl::snapshot_publish() -> sp_node_snapshot {
+	if(auto res = snapshot()) return res;
+
+	auto S = std::make_shared<node_snapshot>();
+	S->leafs = values<Key::AnyOrder>();
+	S->index.reserve(S->leafs.size());
+	for(std::size_t i = 0; i < S->leafs.size(); ++i)
+		S->index.emplace(S->leafs[i].id(), i);
+
+	auto res = sp_node_snapshot{std::move(S)};
+	std::atomic_store(&snapshot_, res);
+	return res;
+}
+
+auto node_impl::snapshot_reset() -> void {
+	std::atomic_store(&snapshot_, sp_node_snapshot{});
+	touch();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  epochs
+//
+NAMESPACE_BEGIN()
+
+std::atomic<std::uint64_t> tree_epoch_ = 0;
+
+NAMESPACE_END()
+
+auto node_impl::epoch(const node& N) -> std::uint64_t {
+	return N.pimpl()->epoch_.load();
+}
+
+auto node_impl::tree_epoch() -> std::uint64_t {
+	return tree_epoch_.load();
+}
+
+auto node_impl::touch() -> void {
+	++epoch_;
+	++tree_epoch_;
+}
+
 auto node_impl::keys(Key order) const -> lids_v {
 	switch(order) {
 	case Key::ID: return keys<Key::ID>();
 	case Key::AnyOrder: return keys<Key::ID, Key::AnyOrder>();
 	case Key::Name: return keys<Key::ID, Key::Name>();
+	case Key::OID:
+	case Key::Type:
+		return keys<Key::ID>(leafs(order));
 	default: return {};
 	}
 }
@@ -133,6 +247,11 @@ auto node_impl::ikeys(Key order) const -> std::vector<std::size_t> {
 	case Key::ID: return keys<Key::AnyOrder, Key::ID>();
 	case Key::AnyOrder: return keys<Key::AnyOrder>();
 	case Key::Name: return keys<Key::AnyOrder, Key::Name>();
+	case Key::OID:
+	case Key::Type: {
+		const auto Ls = leafs(order);
+		return ikeys(Ls.begin(), Ls.end());
+	}
 	default: return {};
 	}
 }
@@ -142,16 +261,97 @@ auto node_impl::leafs(Key order) const -> links_v {
 	case Key::AnyOrder: return values<Key::AnyOrder>();
 	case Key::ID: return values<Key::ID>();
 	case Key::Name: return values<Key::Name>();
+	case Key::OID: return extraidx_ ? extraidx_values<Key::OID>() : links_v{};
+	case Key::Type: return extraidx_ ? extraidx_values<Key::Type>() : links_v{};
 	default: return {};
 	}
 }
 
+auto node_impl::leafs(Key order, std::size_t offset, std::size_t count) const -> links_v {
+	const auto extra_leafs = [](const auto& r) {
+		return r.template extract<link>([](const auto& x) { return x.L; });
+	};
+
+	switch(order) {
+	case Key::AnyOrder: return window<Key::AnyOrder>(offset, count).extract_values();
+	case Key::ID: return window<Key::ID>(offset, count).extract_values();
+	case Key::Name: return window<Key::Name>(offset, count).extract_values();
+	case Key::OID: return extraidx_ ? extra_leafs(window<Key::OID>(offset, count)) : links_v{};
+	case Key::Type: return extraidx_ ? extra_leafs(window<Key::Type>(offset, count)) : links_v{};
+	default: return {};
+	}
+}
+
+auto node_impl::keys(Key order, std::size_t offset, std::size_t count) const -> lids_v {
+	const auto extra_keys = [](const auto& r) {
+		return r.template extract<lid_type>([](const auto& x) { return x.id(); });
+	};
+
+	switch(order) {
+	case Key::AnyOrder: return window<Key::AnyOrder>(offset, count).extract_keys();
+	case Key::ID: return window<Key::ID>(offset, count).extract_keys();
+	case Key::Name: return window<Key::Name>(offset, count).extract_keys();
+	case Key::OID: return extraidx_ ? extra_keys(window<Key::OID>(offset, count)) : lids_v{};
+	case Key::Type: return extraidx_ ? extra_keys(window<Key::Type>(offset, count)) : lids_v{};
+	default: return {};
+	}
+}
+
+auto node_impl::ikeys(Key order, std::size_t offset, std::size_t count) const -> std::vector<std::size_t> {
+	const auto do_ikeys = [&](const auto& r) { return ikeys(r.begin(), r.end()); };
+
+	switch(order) {
+	case Key::AnyOrder: return do_ikeys(window<Key::AnyOrder>(offset, count));
+	case Key::ID: return do_ikeys(window<Key::ID>(offset, count));
+	case Key::Name: return do_ikeys(window<Key::Name>(offset, count));
+	case Key::OID:
+		return extraidx_ ? do_ikeys(window<Key::OID>(offset, count)) : std::vector<std::size_t>{};
+	case Key::Type:
+		return extraidx_ ? do_ikeys(window<Key::Type>(offset, count)) : std::vector<std::size_t>{};
+	default: return {};
+	}
+}
+
+auto node_impl::skeys(Key meaning, Key order) const -> std::vector<std::string> {
+	const auto extra_key = [&](const link& L) -> std::string {
+		if(!extraidx_) return {};
+		const auto& I = extraidx_->get<Key_tag<Key::ID>>();
+		if(auto p = I.find(L.id()); p != I.end())
+			return meaning == Key::OID ? p->oid : p->otid;
+		return {};
+	};
+
+	const auto Ls = leafs(order);
+	return range_t(Ls.begin(), Ls.end()).extract<std::string>([&](const link& L) -> std::string {
+		switch(meaning) {
+		case Key::ID: return to_string(L.id());
+		case Key::Name: return L.name(unsafe);
+		case Key::OID:
+		case Key::Type:
+			return extra_key(L);
+		default: return {};
+		}
+	});
+}
+
 auto node_impl::search(const std::string& key, Key key_meaning) const -> link {
 	switch(key_meaning) {
 	case Key::ID:
 		return to_uuid(key).map([&](lid_type lid) { return search<Key::ID>(lid); }).value_or(link{});
 	case Key::Name:
 		return search<Key::Name>(key);
+	case Key::OID:
+		if(extraidx_) {
+			if(auto r = extraidx_range<Key::OID>(key); r.begin() != r.end())
+				return r.begin()->L;
+		}
+		return {};
+	case Key::Type:
+		if(extraidx_) {
+			if(auto r = extraidx_range<Key::Type>(key); r.begin() != r.end())
+				return r.begin()->L;
+		}
+		return {};
 	default:
 		return {};
 	}
@@ -163,6 +363,11 @@ auto node_impl::index(const std::string& key, Key key_meaning) const -> existing
 		return to_uuid(key).map([&](lid_type lid) { return index<Key::ID>(lid); }).value_or(existing_index{});
 	case Key::Name:
 		return index<Key::Name>(key);
+	case Key::OID:
+	case Key::Type:
+		if(auto L = search(key, key_meaning))
+			return index<Key::ID>(L.id());
+		return {};
 	default:
 		return {};
 	}
@@ -176,17 +381,63 @@ auto node_impl::equal_range(const std::string& key, Key key_meaning) const -> li
 		).value_or(links_v{});
 	case Key::Name:
 		return equal_range<Key::Name>(key).extract_values();
+	case Key::OID:
+		if(extraidx_)
+			return extraidx_range<Key::OID>(key).extract<link>([](const auto& x) { return x.L; });
+		return {};
+	case Key::Type:
+		if(extraidx_)
+			return extraidx_range<Key::Type>(key).extract<link>([](const auto& x) { return x.L; });
+		return {};
 	default:
 		return {};
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+//  OID & object type indexes
+//
+auto node_impl::has_index(Key order) const -> bool {
+	// extra indexes are valid only when all keys are fetched
+	return has_builtin_index(order) ||
+		(extraidx_ && extraidx_pending_.empty() && extraidx_queue_.empty());
+}
+
+auto node_impl::extraidx_enable() -> void {
+	if(extraidx_) return;
+	extraidx_.emplace();
+	for(const auto& L : links_)
+		extraidx_touch(L);
+}
+
+auto node_impl::extraidx_touch(const link& L) -> void {
+	if(!extraidx_) return;
+	// entry with empty keys is inserted immediately & updated after keys are fetched
+	extraidx_->insert(detail::extraidx_entry{L, {}, {}});
+	extraidx_queue_.push_back(L);
+}
+
+auto node_impl::extraidx_update(const lid_type& lid, std::string oid, std::string otid) -> void {
+	if(auto p = extraidx_pending_.find(lid); p != extraidx_pending_.end() && --p->second <= 0)
+		extraidx_pending_.erase(p);
+	if(!extraidx_) return;
+
+	// entry can be missing if leaf was erased while keys request was in flight
+	auto& I = extraidx_->get<Key_tag<Key::ID>>();
+	if(auto p = I.find(lid); p != I.end())
+		I.modify(p, [&](detail::extraidx_entry& x) {
+			x.oid = std::move(oid);
+			x.otid = std::move(otid);
+		});
+}
+
 auto node_impl::rename(iterator<Key::Name> pos, std::string new_name) -> void {
 	// rename & update index
 	// must be called atomically for both node & link at given pos
 	links_.get<Key_tag<Key::Name>>().modify(
 		std::move(pos), [&](link& L) { L.pimpl()->rename(std::move(new_name)); }
 	);
+	touch();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -258,6 +509,9 @@ auto node_impl::insert(link L, InsertPolicy pol) -> insert_status<Key::ID> {
 		// rename link if needed
 		if(Lname)
 			rename(project<Key::ID, Key::Name>(res.first), std::move(*Lname));
+		// schedule fetching OID & type keys
+		extraidx_touch(L);
+		snapshot_reset();
 	}
 	else {
 		// check if we need to deep merge given links
@@ -275,17 +529,23 @@ auto node_impl::insert(link L, InsertPolicy pol) -> insert_status<Key::ID> {
 	return res;
 }
 
-auto node_impl::erase_impl(iterator<Key::ID> victim, leaf_postproc_fn ppf) -> std::size_t {
+auto node_impl::erase_prepare(const link& L, leaf_postproc_fn ppf) -> void {
 	// preprocess before erasing
-	auto L = *victim;
 	ppf(L);
 
 	// reset link's owner inly if it's owner matches self
 	if(auto Limpl = L.pimpl(); Limpl->owner_ == super_)
 		Limpl->reset_owner(node::nil());
+	if(extraidx_)
+		extraidx_->get<Key_tag<Key::ID>>().erase(L.id());
+}
+
+auto node_impl::erase_impl(iterator<Key::ID> victim, leaf_postproc_fn ppf) -> std::size_t {
+	erase_prepare(*victim, ppf);
 	// erase
 	auto res = index<Key::ID>(victim);
 	links_.get<Key_tag<Key::ID>>().erase(victim);
+	snapshot_reset();
 	return res.value_or(0);
 }
 
@@ -295,17 +555,40 @@ auto node_impl::erase(const std::string& key, Key key_meaning, leaf_postproc_fn
 		return to_uuid(key).map([&](lid_type lid) { return erase<Key::ID>(lid, ppf); }).value_or(0);
 	case Key::Name:
 		return erase<Key::Name>(key, ppf);
+	case Key::OID:
+	case Key::Type:
+		return erase(keys<Key::ID>(equal_range(key, key_meaning)), ppf);
 	default:
 		return 0;
 	}
 }
 
 auto node_impl::erase(const lids_v& r, leaf_postproc_fn ppf) -> std::size_t {
-	std::size_t res = 0;
-	std::for_each(
-		r.begin(), r.end(),
-		[&](const auto& lid) { res += erase(lid, ppf); }
-	);
+	// collect & preprocess victims
+	const auto& I = links_.get<Key_tag<Key::ID>>();
+	auto victims = std::unordered_set<lid_type>{};
+	victims.reserve(r.size());
+	for(const auto& lid : r) {
+		if(auto p = I.find(lid); p != I.end() && victims.insert(lid).second)
+			erase_prepare(*p, ppf);
+	}
+	if(victims.empty()) return 0;
+
+	// remove all victims in single pass over AnyOrder index
+	links_.get<Key_tag<Key::AnyOrder>>().remove_if([&](const link& L) {
+		return victims.find(L.id()) != victims.end();
+	});
+	snapshot_reset();
+	return victims.size();
+}
+
+auto node_impl::clear() -> std::size_t {
+	auto res = links_.size();
+	links_.clear();
+	snapshot_reset();
+	if(extraidx_) extraidx_->clear();
+	extraidx_pending_.clear();
+	extraidx_queue_.clear();
 	return res;
 }
 
@@ -16,10 +16,31 @@
 #include "link_impl.h"
 
 #include <cereal/types/vector.hpp>
+#include <caf/typed_response_promise.hpp>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 
 NAMESPACE_BEGIN(blue_sky::tree)
 using existing_index = typename node::existing_index;
 
+/// immutable copy of node content that can be read from any thread without messaging node actor
+struct node_snapshot {
+	// leafs in AnyOrder
+	links_v leafs;
+	// link ID -> position in `leafs`
+	std::unordered_map<lid_type, std::size_t> index;
+
+	auto find(const lid_type& lid) const -> existing_index {
+		if(auto p = index.find(lid); p != index.end())
+			return p->second;
+		return {};
+	}
+};
+using sp_node_snapshot = std::shared_ptr<const node_snapshot>;
+
 /*-----------------------------------------------------------------------------
  *  node_impl
  *-----------------------------------------------------------------------------*/
@@ -39,10 +60,10 @@ public:
 	// public node iface extended with some private messages
 	using primary_actor_type = node::actor_type
 	::extend<
-		// join self group
-		caf::reacts_to<a_hi>,
 		// erase link by ID with specified options
 		caf::replies_to<a_node_erase, lid_type, EraseOpts>::with<std::size_t>,
+		// erase bunch of links with specified options
+		caf::replies_to<a_node_erase, lids_v, EraseOpts>::with<std::size_t>,
 		// deep search by ID with active symlinks
 		caf::replies_to<a_node_deep_search, lid_type /* key */, lids_v /* active_symlinks */>::with<links_v>,
 		// deep search by key with active symlinks
@@ -57,6 +78,8 @@ public:
 		caf::reacts_to<a_ack, caf::actor, a_node_insert, lid_type, size_t>,
 		// ack on link move
 		caf::reacts_to<a_ack, caf::actor, a_node_insert, lid_type, size_t, size_t>,
+		// ack on bulk insert - links with given IDs occupy positions starting from given one
+		caf::reacts_to<a_ack, caf::actor, a_node_insert, lids_v, std::vector<std::size_t>>,
 		// ack on link erase from sibling node
 		caf::reacts_to<a_ack, caf::actor, a_node_erase, lids_v>
 	>;
@@ -86,6 +109,43 @@ public:
 	// leafs
 	links_container links_;
 
+	// persistent OID & object type indexes, built on first demand
+	std::optional<extraidx_container> extraidx_;
+	// number of in-flight keys requests per leaf
+	std::unordered_map<lid_type, int> extraidx_pending_;
+	// leafs which keys must be (re)fetched by node actor
+	links_v extraidx_queue_;
+
+	// aggregate subtree counters, maintained by node actor after first demand
+	std::optional<node::subtree_stats> stats_;
+	// object type & subtree presence each leaf is counted with in `stats_`
+	struct stats_leaf {
+		std::string otid;
+		bool is_node = false;
+	};
+	std::unordered_map<lid_type, stats_leaf> stats_leafs_;
+	// number of nested subtrees being counted & requests waiting for complete `stats_`
+	std::size_t stats_pending_ = 0;
+	std::vector<caf::typed_response_promise<node::subtree_stats>> stats_waiters_;
+
+	// last published snapshot of leafs, reset on every modification
+	// [NOTE] access only via `snapshot*()` functions below
+	sp_node_snapshot snapshot_;
+	// counter of leafs modifications, see `epoch()`
+	std::atomic<std::uint64_t> epoch_ = 0;
+
+	// cached `deep_demand()` with epochs it was calculated at
+	struct demand_cache {
+		std::uint64_t listeners_epoch, paths_epoch;
+		Event mask;
+	};
+	mutable std::optional<demand_cache> demand_;
+	mutable engine_impl_mutex demand_guard_;
+
+	// paths of node's handle that leafs paths are built on, expired when handle or it's paths change
+	// [NOTE] access only via atomic load/store
+	mutable link_impl::sp_abspath_cache paths_base_;
+
 	///////////////////////////////////////////////////////////////////////////////
 	//  API
 	//
@@ -93,6 +153,9 @@ public:
 	auto handle() const -> link;
 	auto set_handle(const link& handle) -> void;
 
+	// absolute paths of node's handle used as prefix of leafs paths (empty for root node)
+	auto abspath_base() const -> link_impl::sp_abspath_cache;
+
 	// setup super (weak engine ptr) + correct leafs owner
 	// node is REQUIRED to call this after engine is started
 	auto propagate_owner(const node& super, bool deep) -> void;
@@ -102,6 +165,14 @@ public:
 
 	static auto spawn_actor(sp_nimpl nimpl) -> caf::actor;
 
+	// union of deep listeners masks of this node and all it's ancestors
+	// [NOTE] cached until listeners registrations or tree structure are changed
+	auto deep_demand() const -> Event;
+	// check if deep listeners of this node or it's ancestors want event `ev`
+	auto deep_listens(Event ev) const -> bool;
+	// check if anyone up the tree listens to event `ev` coming from this node subtree
+	auto upstream_listens(Event ev) const -> bool;
+
 	ENGINE_TYPE_DECL
 
 	///////////////////////////////////////////////////////////////////////////////
@@ -236,8 +307,77 @@ public:
 
 	auto leafs(Key order) const -> links_v;
 
+	///////////////////////////////////////////////////////////////////////////////
+	//  paged access
+	//
+	// range of at most `count` elements starting from `offset` in index `I` with order `K`
+	template<Key K, typename Index>
+	static auto window(const Index& I, std::size_t offset, std::size_t count) {
+		offset = std::min(offset, static_cast<std::size_t>(I.size()));
+		count = std::min(count, static_cast<std::size_t>(I.size()) - offset);
+		auto first = [&] {
+			// ranked indexes can reach n-th element in logarithmic time
+			if constexpr(K == Key::Name || K == Key::OID || K == Key::Type)
+				return I.nth(offset);
+			else
+				return std::next(I.begin(), offset);
+		}();
+		auto last = std::next(first, count);
+		return range_t(std::move(first), std::move(last));
+	}
+
+	template<Key K>
+	auto window(std::size_t offset, std::size_t count) const {
+		if constexpr(has_builtin_index_v<K>)
+			return window<K>(links_.get<Key_tag<K>>(), offset, count);
+		else
+			return window<K>(extraidx_->get<Key_tag<K>>(), offset, count);
+	}
+
+	// leafs & keys sorted by `order` in window [offset, offset + count)
+	auto leafs(Key order, std::size_t offset, std::size_t count) const -> links_v;
+	auto keys(Key order, std::size_t offset, std::size_t count) const -> lids_v;
+	auto ikeys(Key order, std::size_t offset, std::size_t count) const -> std::vector<std::size_t>;
+
+	// string keys of `meaning` index sorted by `order`
+	auto skeys(Key meaning, Key order) const -> std::vector<std::string>;
+
 	auto size() const -> std::size_t;
 
+	///////////////////////////////////////////////////////////////////////////////
+	//  snapshots
+	//
+	// atomically load last published snapshot, returns nullptr if node was modified since then
+	auto snapshot() const -> sp_node_snapshot;
+	// build & publish snapshot if node was modified after last publish
+	// [NOTE] must be called only by node actor (or other single writer)
+	auto snapshot_publish() -> sp_node_snapshot;
+	// drop published snapshot & bump epochs, must be called after any modification of `links_`
+	auto snapshot_reset() -> void;
+
+	///////////////////////////////////////////////////////////////////////////////
+	//  modification epochs
+	//
+	// counter of leafs modifications (insert, erase, rename, rearrange) of given node
+	static auto epoch(const node& N) -> std::uint64_t;
+	// same counter summed over all nodes, cheap check if anything in the tree has changed
+	static auto tree_epoch() -> std::uint64_t;
+	// bump both counters
+	auto touch() -> void;
+
+	///////////////////////////////////////////////////////////////////////////////
+	//  OID & object type indexes
+	//
+	// check if requests with given key can be served directly from index
+	auto has_index(Key order) const -> bool;
+
+	// start maintaining extra indexes & schedule keys fetch for all leafs
+	auto extraidx_enable() -> void;
+	// schedule keys refresh for given leaf (if extra indexes are maintained)
+	auto extraidx_touch(const link& L) -> void;
+	// store fetched keys of leaf with given ID
+	auto extraidx_update(const lid_type& lid, std::string oid, std::string otid) -> void;
+
 	///////////////////////////////////////////////////////////////////////////////
 	//  insert & erase
 	//
@@ -260,8 +400,12 @@ public:
 
 	auto erase(const std::string& key, Key key_meaning, leaf_postproc_fn ppf = noop) -> size_t;
 
+	// erase bunch of leafs in single pass, returns number of erased leafs
 	auto erase(const lids_v& r, leaf_postproc_fn ppf = noop) -> std::size_t;
 
+	// remove all leafs, returns number of erased leafs
+	auto clear() -> std::size_t;
+
 	///////////////////////////////////////////////////////////////////////////////
 	//  rename
 	//
@@ -286,6 +430,7 @@ public:
 		}
 		// apply order
 		links_.get<Key_tag<Key::AnyOrder>>().rearrange(i_order.begin());
+		snapshot_reset();
 		return perfect;
 	}
 
@@ -293,6 +438,25 @@ private:
 	// weak ref to parent link
 	link::weak_ptr handle_;
 
+	// leafs with given key in extra index
+	template<Key K>
+	auto extraidx_range(const std::string& key) const {
+		auto [first, last] = extraidx_->get<Key_tag<K>>().equal_range(key);
+		return range_t(first, last);
+	}
+
+	// leafs stored in extra index with given order
+	template<Key K>
+	auto extraidx_values() const -> links_v {
+		const auto& I = extraidx_->get<Key_tag<K>>();
+		return range_t(I.begin(), I.end()).template extract<link>(
+			[](const auto& x) { return x.L; }
+		);
+	}
+
+	// invoke postprocessing for leaf being erased, reset it's owner & remove from extra indexes
+	auto erase_prepare(const link& L, leaf_postproc_fn ppf) -> void;
+
 	// returns index of removed element
 	// [NOTE] don't do range checking
 	auto erase_impl(iterator<Key::ID> key, leaf_postproc_fn ppf = noop) -> std::size_t;
@@ -300,10 +464,7 @@ private:
 	// erase multiple elements given in valid (!) range
 	template<Key K = Key::ID>
 	auto erase(const range<K>& r, leaf_postproc_fn ppf = noop) -> size_t {
-		size_t res = 0;
-		for(auto x = r.begin(); x != r.end();)
-			res += erase_impl(project<K, Key::ID>(x++), ppf);
-		return res;
+		return erase(keys<Key::ID>(r.begin(), r.end()), std::move(ppf));
 	}
 };
 using sp_nimpl = node_impl::sp_nimpl;
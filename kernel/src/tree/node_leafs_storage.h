@@ -11,10 +11,12 @@
 #include <bs/tree/node.h>
 
 #include <boost/multi_index_container.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index/random_access_index.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/ranked_index.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/member.hpp>
 
 #include <algorithm>
 #include <numeric>
@@ -33,9 +35,11 @@ using id_key = mi::const_mem_fun<
 	link, lid_type, &link::id
 >;
 // and non-unique name
-struct name_key {
+// [NOTE] return reference to name stored in link impl => no copies on index lookup/update
+// name is modified only via index `modify()` under node's lock, so reference stays valid
+struct BS_HIDDEN_API name_key {
 	using result_type = std::string;
-	auto operator()(const link& L) const { return L.name(unsafe); };
+	auto operator()(const link& L) const -> const std::string&;
 };
 // and non-unique object ID
 using oid_key = mi::const_mem_fun<
@@ -46,6 +50,7 @@ using type_key = mi::const_mem_fun<
 	link, std::string, &link::obj_type_id
 >;
 // and have random-access index that preserve custom items ordering
+// [NOTE] gives O(1) position <-> iterator conversion, while keeping `relocate()` & `rearrange()`
 struct any_order {};
 
 // convert from key alias -> key type
@@ -78,12 +83,43 @@ struct Key_dispatch<Key::AnyOrder> {
 NAMESPACE_END(detail)
 
 // container that will store all node elements (links)
+// [NOTE] sorted indexes are ranked => n-th element can be reached in logarithmic time
 using links_container = mi::multi_index_container<
 	link,
 	mi::indexed_by<
-		mi::sequenced< mi::tag<detail::any_order> >,
+		mi::random_access< mi::tag<detail::any_order> >,
 		mi::hashed_unique< mi::tag<detail::id_key>, detail::id_key >,
-		mi::ordered_non_unique< mi::tag<detail::name_key>, detail::name_key >
+		mi::ranked_non_unique< mi::tag<detail::name_key>, detail::name_key >
+	>
+>;
+
+/*-----------------------------------------------------------------------------
+ *  persistent OID & object type indexes
+ *-----------------------------------------------------------------------------*/
+NAMESPACE_BEGIN(detail)
+
+// leaf with cached keys that require actor request to obtain
+struct extraidx_entry {
+	link L;
+	std::string oid;
+	std::string otid;
+
+	auto id() const -> lid_type { return L.id(); }
+};
+
+using extraidx_id_key = mi::const_mem_fun<extraidx_entry, lid_type, &extraidx_entry::id>;
+using extraidx_oid_key = mi::member<extraidx_entry, std::string, &extraidx_entry::oid>;
+using extraidx_type_key = mi::member<extraidx_entry, std::string, &extraidx_entry::otid>;
+
+NAMESPACE_END(detail)
+
+// [NOTE] reuse tags from main links container, so `Key_tag<K>` works for both
+using extraidx_container = mi::multi_index_container<
+	detail::extraidx_entry,
+	mi::indexed_by<
+		mi::hashed_unique< mi::tag<detail::id_key>, detail::extraidx_id_key >,
+		mi::ranked_non_unique< mi::tag<detail::oid_key>, detail::extraidx_oid_key >,
+		mi::ranked_non_unique< mi::tag<detail::type_key>, detail::extraidx_type_key >
 	>
 >;
 
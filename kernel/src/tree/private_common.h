@@ -24,7 +24,8 @@ using defaults::tree::nil_oid;
 inline const auto nil_otid = blue_sky::defaults::nil_type_name;
 
 /// link erase options
-enum class EraseOpts { Normal = 0, Silent = 1 };
+/// [NOTE] `Deferred` means that erased subtree IDs are collected by background worker
+enum class EraseOpts { Normal = 0, Silent = 1, Deferred = 2 };
 
 enum class ReqOpts : std::uint32_t {
 	WaitIfBusy = 0, ErrorIfBusy = 1, ErrorIfNOK = 2, DirectInvoke = 4,
@@ -52,6 +53,8 @@ using engine_home_actor_type = caf::typed_actor<
 using ev_listener_actor_type = caf::typed_actor<
 	// returns ev listener actor ID
 	caf::replies_to<a_hi, caf::group /* source home */>::with<std::uint64_t>,
+	// deliver coalesced events batch with given generation
+	caf::reacts_to<a_flush, std::uint64_t>,
 	// ceases to exit
 	caf::reacts_to<a_bye>
 >;
@@ -59,6 +62,7 @@ using ev_listener_actor_type = caf::typed_actor<
 NAMESPACE_END(blue_sky::tree)
 
 BS_ALLOW_ENUMOPS(tree::ReqOpts)
+BS_ALLOW_ENUMOPS(tree::EraseOpts)
 
 CAF_BEGIN_TYPE_ID_BLOCK(bs_private, blue_sky::detail::bs_private_cid_begin)
 
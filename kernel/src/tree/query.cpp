@@ -0,0 +1,370 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Predicate queries over BS tree subtrees
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+
+#include <bs/tree/query.h>
+#include <bs/objbase.h>
+#include <bs/meta.h>
+#include <bs/kernel/radio.h>
+
+#include "tree_impl.h"
+
+#include <caf/event_based_actor.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
+#include <variant>
+
+NAMESPACE_BEGIN(blue_sky::tree)
+using namespace allow_enumops;
+using sp_expr = query::sp_expr;
+
+/*-----------------------------------------------------------------------------
+ *  query expression tree
+ *-----------------------------------------------------------------------------*/
+NAMESPACE_BEGIN()
+
+struct any_expr {};
+struct key_expr { std::string key; Key meaning; };
+struct glob_expr { std::string pattern; };
+struct flags_expr { Flags mask; };
+struct status_expr { Req request; ReqStatus status; };
+struct link_expr { query::link_pred_f f; };
+struct obj_expr { query::obj_pred_f f; };
+struct and_expr { std::vector<sp_expr> args; };
+struct or_expr { std::vector<sp_expr> args; };
+struct not_expr { sp_expr arg; };
+
+NAMESPACE_END()
+
+struct query::expr {
+	std::variant<
+		any_expr, key_expr, glob_expr, flags_expr, status_expr,
+		link_expr, obj_expr, and_expr, or_expr, not_expr
+	> value;
+};
+
+NAMESPACE_BEGIN()
+
+template<typename Expr>
+auto make_expr(Expr e) -> sp_expr {
+	return std::make_shared<const query::expr>(query::expr{std::move(e)});
+}
+
+template<typename Expr>
+auto is(const sp_expr& e) -> bool {
+	return std::holds_alternative<Expr>(e->value);
+}
+
+// relative cost of expression evaluation, cheap checks go first inside conjunction
+auto cost(const sp_expr& e) -> int {
+	return std::visit(meta::overloaded{
+		[](const any_expr&) { return 0; },
+		[](const status_expr&) { return 0; },
+		[](const obj_expr&) { return 3; },
+		[](const link_expr&) { return 2; },
+		[](const and_expr& E) {
+			return E.args.empty() ? 0 : cost(E.args.back());
+		},
+		[](const or_expr& E) {
+			auto res = 0;
+			for(const auto& arg : E.args) res = std::max(res, cost(arg));
+			return res;
+		},
+		[](const not_expr& E) { return cost(E.arg); },
+		// other checks require single request to link actor
+		[](const auto&) { return 1; }
+	}, e->value);
+}
+
+// '*' matches any sequence, '?' - any single char
+auto glob_match(std::string_view pattern, std::string_view s) -> bool {
+	std::size_t p = 0, i = 0;
+	// position of last '*' in pattern & matched position in string
+	auto star = std::string_view::npos;
+	std::size_t star_i = 0;
+	while(i < s.size()) {
+		if(p < pattern.size() && (pattern[p] == '?' || pattern[p] == s[i])) {
+			++p; ++i;
+		}
+		else if(p < pattern.size() && pattern[p] == '*') {
+			star = p++;
+			star_i = i;
+		}
+		else if(star != std::string_view::npos) {
+			// let last '*' consume one more char
+			p = star + 1;
+			i = ++star_i;
+		}
+		else
+			return false;
+	}
+	while(p < pattern.size() && pattern[p] == '*') ++p;
+	return p == pattern.size();
+}
+
+// obtain link's object honoring LazyLoad flag
+auto query_data(const link& L, TreeOpts opts) -> sp_obj {
+	if(enumval(opts & TreeOpts::FollowLazyLinks) || L.req_status(Req::Data) == ReqStatus::OK
+		|| !(L.flags() & LazyLoad))
+		return L.data();
+	return nullptr;
+}
+
+// `served` is expression that was already checked by index lookup
+auto eval(const sp_expr& e, const link& L, TreeOpts opts, const query::expr* served = nullptr) -> bool {
+	if(e.get() == served) return true;
+	return std::visit(meta::overloaded{
+		[](const any_expr&) { return true; },
+		[&](const key_expr& E) {
+			switch(E.meaning) {
+			case Key::ID :
+				return to_string(L.id()) == E.key;
+			case Key::OID :
+				return L.oid() == E.key;
+			case Key::Name :
+				return L.name() == E.key;
+			case Key::Type :
+				return L.obj_type_id() == E.key;
+			default:
+				return false;
+			}
+		},
+		[&](const glob_expr& E) { return glob_match(E.pattern, L.name()); },
+		[&](const flags_expr& E) { return (L.flags() & E.mask) == E.mask; },
+		[&](const status_expr& E) { return L.req_status(E.request) == E.status; },
+		[&](const link_expr& E) { return E.f(L); },
+		[&](const obj_expr& E) {
+			const auto obj = query_data(L, opts);
+			return obj && E.f(obj);
+		},
+		[&](const and_expr& E) {
+			return std::all_of(E.args.begin(), E.args.end(), [&](const auto& arg) {
+				return eval(arg, L, opts, served);
+			});
+		},
+		[&](const or_expr& E) {
+			return std::any_of(E.args.begin(), E.args.end(), [&](const auto& arg) {
+				return eval(arg, L, opts, served);
+			});
+		},
+		[&](const not_expr& E) { return !eval(E.arg, L, opts); }
+	}, e->value);
+}
+
+// priority of index lookups: builtin indexes first
+auto index_rank(Key meaning) -> int {
+	switch(meaning) {
+	case Key::ID : return 0;
+	case Key::Name : return 1;
+	default: return 2;
+	}
+}
+
+// select candidates from node's indexes, returns nothing if full scan of leafs is required
+// `served` is set to expression that is fully covered by index lookup
+auto pushdown(const sp_expr& e, const node& N, const query::expr*& served) -> std::optional<links_v> {
+	return std::visit(meta::overloaded{
+		[&](const key_expr& E) -> std::optional<links_v> {
+			served = e.get();
+			return N.equal_range(E.key, E.meaning);
+		},
+		[&](const and_expr& E) -> std::optional<links_v> {
+			// lookup by single most selective key
+			const sp_expr* best = nullptr;
+			for(const auto& arg : E.args) {
+				if(!is<key_expr>(arg)) continue;
+				const auto rank = index_rank(std::get<key_expr>(arg->value).meaning);
+				if(!best || rank < index_rank(std::get<key_expr>((*best)->value).meaning))
+					best = &arg;
+			}
+			if(best) return pushdown(*best, N, served);
+			return {};
+		},
+		[&](const or_expr& E) -> std::optional<links_v> {
+			// every branch must be index-able
+			if(!std::all_of(E.args.begin(), E.args.end(), [](const auto& arg) {
+				return is<key_expr>(arg);
+			}))
+				return {};
+			auto res = links_v{};
+			auto met = std::unordered_set<lid_type, boost::hash<lid_type>>{};
+			for(const auto& arg : E.args) {
+				const query::expr* dummy = nullptr;
+				for(auto& L : *pushdown(arg, N, dummy)) {
+					if(met.insert(L.id()).second)
+						res.push_back(std::move(L));
+				}
+			}
+			// candidates match one of keys, but still are checked against full expression
+			return res;
+		},
+		[](const auto&) -> std::optional<links_v> { return {}; }
+	}, e->value);
+}
+
+// flatten nested expressions of same kind and sort conjunction args by cost
+template<typename Expr>
+auto combine(const sp_expr& lhs, const sp_expr& rhs) -> sp_expr {
+	auto res = Expr{};
+	for(const auto* arg : {&lhs, &rhs}) {
+		if(is<any_expr>(*arg)) {
+			// `any` is neutral for conjunction and absorbing for disjunction
+			if constexpr(std::is_same_v<Expr, and_expr>) continue;
+			else return *arg;
+		}
+		if(is<Expr>(*arg)) {
+			const auto& args = std::get<Expr>((*arg)->value).args;
+			res.args.insert(res.args.end(), args.begin(), args.end());
+		}
+		else
+			res.args.push_back(*arg);
+	}
+	if constexpr(std::is_same_v<Expr, and_expr>) {
+		if(res.args.empty()) return make_expr(any_expr{});
+		std::stable_sort(res.args.begin(), res.args.end(), [](const auto& a, const auto& b) {
+			return cost(a) < cost(b);
+		});
+	}
+	if(res.args.size() == 1) return res.args[0];
+	return make_expr(std::move(res));
+}
+
+NAMESPACE_END()
+
+/*-----------------------------------------------------------------------------
+ *  query
+ *-----------------------------------------------------------------------------*/
+query::query() : expr_(make_expr(any_expr{})) {}
+
+query::query(sp_expr e) : expr_(std::move(e)) {}
+
+query::query(std::string key, Key meaning) : expr_(make_expr(key_expr{std::move(key), meaning})) {}
+
+auto query::name_glob(std::string pattern) -> query {
+	// pattern without wildcards is served by name index
+	if(pattern.find_first_of("*?") == std::string::npos)
+		return query(std::move(pattern), Key::Name);
+	return make_expr(glob_expr{std::move(pattern)});
+}
+
+auto query::flags(Flags mask) -> query {
+	return make_expr(flags_expr{mask});
+}
+
+auto query::status(Req request, ReqStatus status) -> query {
+	return make_expr(status_expr{request, status});
+}
+
+auto query::link_pred(link_pred_f f) -> query {
+	return make_expr(link_expr{std::move(f)});
+}
+
+auto query::obj_pred(obj_pred_f f) -> query {
+	return make_expr(obj_expr{std::move(f)});
+}
+
+auto operator&&(const query& lhs, const query& rhs) -> query {
+	return combine<and_expr>(lhs.expr_, rhs.expr_);
+}
+
+auto operator||(const query& lhs, const query& rhs) -> query {
+	return combine<or_expr>(lhs.expr_, rhs.expr_);
+}
+
+auto operator!(const query& q) -> query {
+	// double negation
+	if(is<not_expr>(q.expr_))
+		return std::get<not_expr>(q.expr_->value).arg;
+	return make_expr(not_expr{q.expr_});
+}
+
+auto query::match(const link& L, TreeOpts opts) const -> bool {
+	return L && eval(expr_, L, opts);
+}
+
+auto query::match(const node& N, TreeOpts opts) const -> links_v {
+	if(!N) return {};
+	const query::expr* served = nullptr;
+	auto candidates = pushdown(expr_, N, served);
+	auto res = candidates ? std::move(*candidates) : N.leafs();
+	// if whole query is served by index, candidates are final
+	if(served == expr_.get()) return res;
+
+	res.erase(std::remove_if(res.begin(), res.end(), [&](const link& L) {
+		return !eval(expr_, L, opts, served);
+	}), res.end());
+	return res;
+}
+
+/*-----------------------------------------------------------------------------
+ *  search
+ *-----------------------------------------------------------------------------*/
+NAMESPACE_BEGIN()
+
+// evaluate every node of `root` subtree in parallel, `f(node, matches)` calls are serialized
+// returning `false` from `f` stops search
+template<typename F>
+auto search_impl(const link& root, const query& q, TreeOpts opts, std::size_t n_workers, F&& f) {
+	auto f_guard = std::mutex{};
+	auto stopped = std::atomic<bool>{false};
+	// nodes reachable via several paths (symlinks) are evaluated once
+	auto visited_guard = std::mutex{};
+	auto visited = std::unordered_set<std::string>{};
+
+	const auto step = [&](const link& H, std::list<link>& nodes, links_v&) {
+		const auto N = !stopped && detail::can_call_dnode(H, opts) ? H.data_node() : node::nil();
+		const auto is_new = N && [&] {
+			auto guard = std::lock_guard{visited_guard};
+			return visited.emplace(N.home_id()).second;
+		}();
+		if(!is_new) {
+			nodes.clear();
+			return;
+		}
+
+		auto matches = q.match(N, opts);
+		if(matches.empty()) return;
+
+		auto guard = std::lock_guard{f_guard};
+		if(!stopped && !f(N, std::move(matches))) {
+			stopped = true;
+			nodes.clear();
+		}
+	};
+	// filter out `WalkUp`, because nodes are evaluated independently
+	walk(root, step, opts & ~TreeOpts::WalkUp, false, n_workers);
+}
+
+NAMESPACE_END()
+
+auto search(link root, const query& q, TreeOpts opts, std::size_t n_workers) -> links_v {
+	auto res = links_v{};
+	search_impl(root, q, opts, n_workers, [&](const node&, links_v matches) {
+		std::move(matches.begin(), matches.end(), std::back_inserter(res));
+		return true;
+	});
+	return res;
+}
+
+auto search(
+	launch_async_t, link root, query q, walk_batch_f f, TreeOpts opts, std::size_t n_workers
+) -> void {
+	kernel::radio::system().spawn<caf::detached>(
+		[root = std::move(root), q = std::move(q), f = std::move(f), opts, n_workers] {
+			search_impl(root, q, opts, n_workers, f);
+			// signal end of search
+			f(node::nil(), {});
+		}
+	);
+}
+
+NAMESPACE_END(blue_sky::tree)
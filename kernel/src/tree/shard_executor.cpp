@@ -0,0 +1,47 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Shard executors implementation
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+
+#include "shard_executor.h"
+#include "../kernel/radio_subsyst.h"
+
+#include <bs/kernel/radio.h>
+
+#include <caf/event_based_actor.hpp>
+
+NAMESPACE_BEGIN(blue_sky::tree::detail)
+NAMESPACE_BEGIN()
+
+struct link_shard_actor : caf::event_based_actor {
+	using super = caf::event_based_actor;
+	using super::super;
+
+	auto make_behavior() -> caf::behavior override { return link_shard_actor_type::behavior_type{
+		[=](a_apply, const link& L, const link_transaction& tr) -> caf::result<tr_result::box> {
+			return tr_eval(this, tr, [&] { return L.bare(); });
+		}
+	}.unbox(); }
+
+	auto name() const -> const char* override { return "link shard actor"; }
+};
+
+NAMESPACE_END()
+
+auto spawn_link_shard(caf::actor_system& sys) -> caf::actor {
+	return sys.spawn<link_shard_actor>();
+}
+
+auto link_shards() -> std::size_t {
+	return KRADIO.link_shards();
+}
+
+auto link_shard(const lid_type& lid) -> link_shard_actor_type {
+	return caf::actor_cast<link_shard_actor_type>(KRADIO.link_shard(std::hash<lid_type>{}(lid)));
+}
+
+NAMESPACE_END(blue_sky::tree::detail)
@@ -0,0 +1,44 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Shard executors that run link transactions in sharded engine mode
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+#pragma once
+
+#include <bs/actor_common.h>
+#include <bs/tree/link.h>
+
+NAMESPACE_BEGIN(blue_sky::tree::detail)
+
+/// shard executor runs transactions of assigned links one by one in order of arrival
+using link_shard_actor_type = caf::typed_actor<
+	caf::replies_to<a_apply, link, link_transaction>::with<tr_result::box>
+>;
+
+/// spawn single shard executor, shards are owned by kernel's radio subsystem
+BS_HIDDEN_API auto spawn_link_shard(caf::actor_system& sys) -> caf::actor;
+
+/// number of shard executors, 0 means that every link runs transactions in own actor
+/// [NOTE] configured by "tree.link_shards" key, read on kernel start
+BS_HIDDEN_API auto link_shards() -> std::size_t;
+
+/// shard executor assigned to link with given ID, nil handle if sharding is disabled
+/// [NOTE] links sharing executor can't make blocking calls to each other from transactions
+/// state-changing requests to link actor (rename, status & flags reset) are also executed by shard,
+/// so transactions can't make blocking calls to actor of own link either
+BS_HIDDEN_API auto link_shard(const lid_type& lid) -> link_shard_actor_type;
+
+/// request execution of transaction `tr` over `L` from `self` actor by link's shard executor
+/// or by link's own actor if sharding is disabled, then pass response handle to `f`
+template<typename Actor, typename F>
+auto request_apply(Actor* self, const link& L, link_transaction tr, F&& f) -> void {
+	if(auto shard = link_shard(L.id()))
+		f(self->request(shard, kernel::radio::timeout(), a_apply(), L, std::move(tr)));
+	else
+		f(self->request(L.actor(), kernel::radio::timeout(), a_apply(), std::move(tr)));
+}
+
+NAMESPACE_END(blue_sky::tree::detail)
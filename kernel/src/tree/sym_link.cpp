@@ -84,15 +84,44 @@ sym_link_impl::sym_link_impl()
 auto sym_link_impl::target() const -> link_or_err {
 	const auto parent = owner();
 	if(!parent) return unexpected_err_quiet(Error::UnboundSymLink);
+	if(auto src_link = cached_target(parent))
+		return src_link;
 
+	const auto start_epoch = node_impl::tree_epoch();
 	link src_link;
 	if(auto er = error::eval_safe([&] { src_link = deref_path(path_, parent); }); er)
 		return tl::make_unexpected(std::move(er));
-	else if(src_link)
+	else if(src_link) {
+		cache_target(parent, src_link, start_epoch);
 		return src_link;
+	}
 	return unexpected_err_quiet(Error::LinkExpired);
 }
 
+auto sym_link_impl::cached_target(const node& parent) const -> link {
+	const auto C = std::atomic_load(&tcache_);
+	if(!C || C->origin != parent) return {};
+	if(auto res = C->lock())
+		return res;
+	std::atomic_store(&tcache_, detail::sp_path_trace{});
+	return {};
+}
+
+auto sym_link_impl::cache_target(const node& parent, const link& target, std::uint64_t start_epoch) const
+-> void {
+	// only plain paths (without '.', '..', etc) can be cached
+	const auto P = compiled_path(path_);
+	if(!P.is_plain()) return;
+
+	const auto depth = P.parts().size() - (P.is_absolute() ? 1 : 0);
+	if(auto C = detail::path_trace::make(
+		target, depth, P.is_absolute() ? find_root(parent) : parent, P.is_absolute(), start_epoch
+	)) {
+		C->origin = parent;
+		std::atomic_store(&tcache_, std::move(C));
+	}
+}
+
 auto sym_link_impl::data() -> obj_or_err {
 	auto res = target().and_then([](const link& src_link) {
 		return src_link.data_ex();
@@ -147,7 +176,7 @@ sym_link::sym_link()
 {}
 
 bool sym_link::check_alive() {
-	auto res = bool(deref_path(SIMPL.path_, owner()));
+	auto res = bool(SIMPL.target());
 	auto S = res ? ReqStatus::OK : ReqStatus::Error;
 	rs_reset_if_neq(Req::Data, S, S);
 	return res;
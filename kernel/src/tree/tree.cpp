@@ -11,17 +11,30 @@
 #include <bs/defaults.h>
 #include <bs/objbase.h>
 #include <bs/uuid.h>
+#include <bs/actor_common.h>
+#include <bs/kernel/config.h>
 #include <bs/kernel/types_factory.h>
 #include <bs/kernel/radio.h>
 #include <bs/detail/enumops.h>
 
 #include "tree_impl.h"
+#include "node_impl.h"
 
 #include <boost/algorithm/string.hpp>
 #include <caf/event_based_actor.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <thread>
+#include <unordered_map>
 
 NAMESPACE_BEGIN(blue_sky::tree)
 /*-----------------------------------------------------------------------------
@@ -35,6 +48,7 @@ void walk_impl(
 	std::set<lid_type> active_symlinks = {}
 ) {
 	using detail::can_call_dnode;
+	const auto prio = detail::interactive_scope(opts);
 	node cur_node;
 	std::list<link> next_nodes;
 	links_v next_leafs;
@@ -84,6 +98,7 @@ void walk_impl(
 	std::set<lid_type> active_symlinks = {}
 ) {
 	using detail::can_call_dnode;
+	const auto prio = detail::interactive_scope(opts);
 	std::list<node> next_nodes;
 	links_v next_leafs;
 
@@ -131,6 +146,352 @@ void walk_impl(
 	}
 }
 
+/*-----------------------------------------------------------------------------
+ *  parallel walk
+ *-----------------------------------------------------------------------------*/
+// simple work-stealing pool: every worker takes tasks from the back of own deque
+// and steals from the front of other deques when own one is empty
+class walk_pool {
+public:
+	using task_t = std::function<void()>;
+
+	walk_pool(std::size_t n_workers) : queues_(std::max<std::size_t>(n_workers, 1)) {
+		workers_.reserve(queues_.size());
+		for(std::size_t i = 0; i < queues_.size(); ++i)
+			workers_.emplace_back([this, i] { work(i); });
+	}
+
+	~walk_pool() {
+		{
+			auto guard = std::lock_guard{idle_guard_};
+			stop_ = true;
+		}
+		idle_cv_.notify_all();
+		for(auto& w : workers_) w.join();
+	}
+
+	// task pushed from worker thread goes to worker's own deque, others are distributed round-robin
+	auto push(task_t t) -> void {
+		auto& Q = queues_[self_pool_ == this ? self_idx_ : next_queue_++ % queues_.size()];
+		{
+			auto guard = std::lock_guard{Q.guard};
+			Q.tasks.push_back(std::move(t));
+		}
+		{
+			auto guard = std::lock_guard{idle_guard_};
+			++n_queued_;
+		}
+		idle_cv_.notify_one();
+	}
+
+private:
+	struct tasks_queue {
+		std::mutex guard;
+		std::deque<task_t> tasks;
+	};
+
+	auto pop(std::size_t idx) -> std::optional<task_t> {
+		const auto n = queues_.size();
+		for(std::size_t k = 0; k < n; ++k) {
+			auto& Q = queues_[(idx + k) % n];
+			auto guard = std::lock_guard{Q.guard};
+			if(Q.tasks.empty()) continue;
+			// own deque is processed LIFO, stealing is FIFO
+			auto res = std::optional<task_t>{};
+			if(k) {
+				res = std::move(Q.tasks.front());
+				Q.tasks.pop_front();
+			}
+			else {
+				res = std::move(Q.tasks.back());
+				Q.tasks.pop_back();
+			}
+			return res;
+		}
+		return {};
+	}
+
+	auto work(std::size_t idx) -> void {
+		self_pool_ = this;
+		self_idx_ = idx;
+		while(true) {
+			// reserve one of queued tasks
+			{
+				auto guard = std::unique_lock{idle_guard_};
+				idle_cv_.wait(guard, [&] { return stop_ || n_queued_ > 0; });
+				if(stop_) return;
+				--n_queued_;
+			}
+			// reserved task is guaranteed to sit in some deque
+			while(true) {
+				if(auto t = pop(idx)) {
+					(*t)();
+					break;
+				}
+			}
+		}
+	}
+
+	std::vector<tasks_queue> queues_;
+	std::vector<std::thread> workers_;
+	std::atomic<std::size_t> next_queue_ = 0;
+
+	std::mutex idle_guard_;
+	std::condition_variable idle_cv_;
+	std::size_t n_queued_ = 0;
+	bool stop_ = false;
+
+	inline static thread_local walk_pool* self_pool_ = nullptr;
+	inline static thread_local std::size_t self_idx_ = 0;
+};
+
+// expands sibling subtrees concurrently using `walk_pool`
+// steps are invoked either directly from workers or serialized through calling thread (sink)
+class parallel_walker {
+public:
+	parallel_walker(walk_links_fv step_f, TreeOpts opts, bool serial_steps, std::size_t n_workers) :
+		step_f_(step_f), opts_(opts), serial_steps_(serial_steps), pool_(n_workers)
+	{}
+
+	// blocks until all subtree of `root` is processed
+	auto run(link root) -> void {
+		schedule(make_item(std::move(root), nullptr, nullptr));
+		// calling thread serves as steps sink
+		while(true) {
+			auto guard = std::unique_lock{sink_guard_};
+			sink_cv_.wait(guard, [&] { return done_ || !steps_.empty(); });
+			if(done_) break;
+			auto s = std::move(steps_.front());
+			steps_.pop_front();
+			guard.unlock();
+			s();
+		}
+		if(error_) std::rethrow_exception(error_);
+	}
+
+private:
+	// chain of active symlinks from root down to current item
+	struct symlinks_chain {
+		lid_type lid;
+		std::shared_ptr<const symlinks_chain> up;
+	};
+	using sp_symlinks = std::shared_ptr<const symlinks_chain>;
+
+	struct walk_item {
+		link L;
+		std::list<link> nodes;
+		links_v leafs;
+		sp_symlinks asl;
+		// for `WalkUp` mode: parent item & number of unfinished children
+		std::shared_ptr<walk_item> parent;
+		std::atomic<std::size_t> pending = 0;
+	};
+	using sp_item = std::shared_ptr<walk_item>;
+
+	static auto make_item(link L, sp_symlinks asl, sp_item parent) -> sp_item {
+		auto X = std::make_shared<walk_item>();
+		X->L = std::move(L);
+		X->asl = std::move(asl);
+		X->parent = std::move(parent);
+		return X;
+	}
+
+	static auto is_active(const sp_symlinks& asl, const lid_type& lid) -> bool {
+		for(auto S = asl.get(); S; S = S->up.get())
+			if(S->lid == lid) return true;
+		return false;
+	}
+
+	// run `f` and stop walk on any exception
+	template<typename F>
+	auto guarded(F&& f) -> void {
+		if(failed_) return;
+		try { f(); }
+		catch(...) {
+			failed_ = true;
+			{
+				auto guard = std::lock_guard{sink_guard_};
+				if(!error_) error_ = std::current_exception();
+				done_ = true;
+			}
+			sink_cv_.notify_all();
+		}
+	}
+
+	auto schedule(sp_item X) -> void {
+		++n_active_;
+		pool_.push([this, X = std::move(X)]() mutable {
+			guarded([&] { expand(std::move(X)); });
+		});
+	}
+
+	// last finished item ends walk
+	auto finish() -> void {
+		if(--n_active_ == 0) {
+			{
+				auto guard = std::lock_guard{sink_guard_};
+				done_ = true;
+			}
+			sink_cv_.notify_all();
+		}
+	}
+
+	// invoke step functor for item directly or via sink, then continue with `then(item)`
+	template<typename F>
+	auto step(sp_item X, F then) -> void {
+		auto do_step = [this, X = std::move(X), then = std::move(then)]() mutable {
+			guarded([&] {
+				step_f_(X->L, X->nodes, X->leafs);
+				then(std::move(X));
+			});
+		};
+		if(serial_steps_) {
+			{
+				auto guard = std::lock_guard{sink_guard_};
+				steps_.push_back(std::move(do_step));
+			}
+			sink_cv_.notify_one();
+		}
+		else
+			do_step();
+	}
+
+	// collect node's children, runs on worker thread
+	auto expand(sp_item X) -> void {
+		const auto prio = detail::interactive_scope(opts_);
+		const auto& L = X->L;
+		// skip symlinks if not following them or if we meet already processed symlink
+		if(!L) return skip(std::move(X));
+		if(L.type_id() == sym_link::type_id_()) {
+			if(!enumval(opts_ & TreeOpts::FollowSymLinks) || is_active(X->asl, L.id()))
+				return skip(std::move(X));
+			X->asl = std::make_shared<const symlinks_chain>(symlinks_chain{L.id(), std::move(X->asl)});
+		}
+
+		// obtain node from link honoring LazyLoad flag
+		if(auto cur_node = detail::can_call_dnode(L, opts_) ? L.data_node() : node::nil()) {
+			for(auto& l : cur_node.leafs()) {
+				if(detail::can_call_dnode(l, opts_) && l.is_node())
+					X->nodes.push_back(std::move(l));
+				else
+					X->leafs.push_back(std::move(l));
+			}
+		}
+
+		if(enumval(opts_ & TreeOpts::WalkUp)) {
+			// process node after all subtree
+			if(X->nodes.empty())
+				return step(std::move(X), [this](sp_item Y) { complete_up(std::move(Y)); });
+			// [NOTE] schedule from copy, because last finished child runs step over `X->nodes`
+			const auto children = links_v(X->nodes.begin(), X->nodes.end());
+			X->pending = children.size();
+			for(const auto& N : children)
+				schedule(make_item(N, X->asl, X));
+		}
+		else {
+			// process node before children, step can modify list of nodes to visit
+			step(std::move(X), [this](sp_item Y) {
+				for(auto& N : Y->nodes)
+					schedule(make_item(std::move(N), Y->asl, nullptr));
+				finish();
+			});
+		}
+	}
+
+	auto skip(sp_item X) -> void {
+		if(enumval(opts_ & TreeOpts::WalkUp))
+			complete_up(std::move(X));
+		else
+			finish();
+	}
+
+	// `WalkUp` mode: item's subtree is done, process parent if it was the last child
+	auto complete_up(sp_item X) -> void {
+		if(auto P = std::move(X->parent); P && --P->pending == 0)
+			step(std::move(P), [this](sp_item Y) { complete_up(std::move(Y)); });
+		finish();
+	}
+
+	walk_links_fv step_f_;
+	const TreeOpts opts_;
+	const bool serial_steps_;
+
+	std::atomic<std::size_t> n_active_ = 0;
+	std::atomic<bool> failed_ = false;
+
+	std::mutex sink_guard_;
+	std::condition_variable sink_cv_;
+	std::deque<std::function<void()>> steps_;
+	std::exception_ptr error_;
+	bool done_ = false;
+
+	// [NOTE] pool must be destroyed first, because it's tasks access all members above
+	walk_pool pool_;
+};
+
+/*-----------------------------------------------------------------------------
+ *  streaming walk
+ *-----------------------------------------------------------------------------*/
+// depth-first walk that reads every level by windows of `batch_size` leafs
+// only current batch + pending subnodes of every level on the path are kept in memory
+template<typename F>
+auto walk_batches(const link& root, F&& f, std::size_t batch_size, TreeOpts opts) -> void {
+	using detail::can_call_dnode;
+	const auto prio = detail::interactive_scope(opts);
+
+	struct level {
+		node N;
+		link handle;
+		bool is_symlink;
+		std::size_t offset = 0;
+		// subnodes found in last batch & next one to enter
+		links_v subnodes = {};
+		std::size_t next_sub = 0;
+	};
+	auto path = std::vector<level>{};
+	auto active_symlinks = std::set<lid_type>{};
+	if(!batch_size) batch_size = 1;
+
+	// push level if link points to node honoring symlinks & LazyLoad flag
+	const auto enter = [&](const link& L) {
+		const auto is_symlink = L.type_id() == sym_link::type_id_();
+		if(is_symlink && (!enumval(opts & TreeOpts::FollowSymLinks) || !active_symlinks.insert(L.id()).second))
+			return;
+		if(auto N = can_call_dnode(L, opts) ? L.data_node() : node::nil())
+			path.push_back(level{std::move(N), L, is_symlink});
+		else if(is_symlink)
+			active_symlinks.erase(L.id());
+	};
+
+	if(root) enter(root);
+	while(!path.empty()) {
+		auto& cur = path.back();
+		// enter subnodes of last batch before reading next one
+		if(cur.next_sub < cur.subnodes.size()) {
+			const auto L = cur.subnodes[cur.next_sub++];
+			enter(L);
+			continue;
+		}
+
+		// read next batch, level is done when it's exhausted
+		auto batch = cur.N.leafs(Key::AnyOrder, cur.offset, batch_size);
+		if(batch.empty()) {
+			if(cur.is_symlink) active_symlinks.erase(cur.handle.id());
+			path.pop_back();
+			continue;
+		}
+		cur.offset += batch.size();
+		cur.subnodes.clear();
+		cur.next_sub = 0;
+		for(const auto& L : batch) {
+			if(can_call_dnode(L, opts) && L.is_node())
+				cur.subnodes.push_back(L);
+		}
+		// next batch is read only after consumer accepted current one
+		if(!f(cur.N, std::move(batch))) return;
+	}
+}
+
 std::string link2path_unit(const link& l, Key path_unit) {
 	switch(path_unit) {
 	default:
@@ -163,6 +524,14 @@ auto to_string(const lids_v& path, bool as_absolute) -> std::string {
 //  abspath
 //
 auto abspath(link L, Key path_unit) -> std::string {
+	// ID & name paths are served from per-link cache
+	// [NOTE] can be turned off by "tree.abspath_cache" config key, value is read once
+	static const auto use_cache = get_or(kernel::config::config(), "tree.abspath_cache", true);
+	if(use_cache && (path_unit == Key::ID || path_unit == Key::Name)) {
+		const auto paths = link_impl::abspath(L);
+		return path_unit == Key::ID ? paths->id_path : paths->name_path;
+	}
+
 	// [NOTE] root ID is irrelevant => abs path always starts with '/'
 	auto parent = L.owner();
 	std::deque<std::string> res;
@@ -233,6 +602,88 @@ auto find_root_handle(node N) -> link {
 	return find_root_handle_impl(N.handle());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+//  compiled_path
+//
+compiled_path::compiled_path(std::string path, Key path_unit)
+	: path_(std::move(path)), path_unit_(path_unit), is_plain_(false)
+{
+	if(path_.empty()) return;
+	boost::split(parts_, path_, boost::is_any_of("/"));
+
+	// leading empty element denotes absolute path
+	const auto from = parts_.begin() + (is_absolute() ? 1 : 0);
+	is_plain_ = from != parts_.end() && std::none_of(from, parts_.end(), [](const auto& part) {
+		return part.empty() || part == "." || part == "..";
+	});
+	if(!is_plain_ || path_unit_ != Key::ID) return;
+
+	lids_.reserve(parts_.end() - from);
+	for(auto part = from; part != parts_.end(); ++part) {
+		if(auto lid = to_uuid(*part))
+			lids_.push_back(*lid);
+		else {
+			lids_.clear();
+			break;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  path trace
+//
+NAMESPACE_BEGIN(detail)
+
+auto path_trace::make(
+	const link& target, std::size_t depth, const node& start, bool is_absolute,
+	std::uint64_t start_epoch
+) -> sp_path_trace {
+	if(!target || !depth || !start) return nullptr;
+
+	// walk up from target and ensure that path goes strictly down from start node
+	auto res = std::make_shared<path_trace>();
+	res->nodes.reserve(depth);
+	auto L = target;
+	for(auto i = depth; i > 0; --i) {
+		const auto N = L ? L.owner() : node::nil();
+		if(!N) return nullptr;
+		res->nodes.emplace_back(N, node_impl::epoch(N));
+		if(i > 1)
+			L = N.handle();
+		else if(N != start)
+			return nullptr;
+	}
+	// don't trust trace if tree was modified while path was resolved
+	if(node_impl::tree_epoch() != start_epoch) return nullptr;
+
+	res->target = target;
+	res->is_absolute = is_absolute;
+	res->tree_epoch = start_epoch;
+	return res;
+}
+
+auto path_trace::lock() -> link {
+	// fast path: nothing was modified in the whole tree since last check
+	const auto cur_epoch = node_impl::tree_epoch();
+	if(tree_epoch == cur_epoch)
+		return target.lock();
+
+	// otherwise check that nodes along the path weren't modified
+	for(const auto& [wN, N_epoch] : nodes) {
+		const auto N = wN.lock();
+		if(!N || node_impl::epoch(N) != N_epoch) return {};
+	}
+	// absolute path start (root node) must not be inserted anywhere
+	if(is_absolute) {
+		const auto root_h = nodes.back().first.lock().handle();
+		if(root_h && root_h.owner()) return {};
+	}
+	tree_epoch = cur_epoch;
+	return target.lock();
+}
+
+NAMESPACE_END(detail)
+
 ///////////////////////////////////////////////////////////////////////////////
 //  convert_path
 //
@@ -240,6 +691,22 @@ std::string convert_path(
 	std::string src_path, link start,
 	Key src_path_unit, Key dst_path_unit, TreeOpts opts
 ) {
+	boost::trim(src_path);
+	const auto P = compiled_path(std::move(src_path), src_path_unit);
+
+	// plain path of IDs is converted via links registry without levels lookup
+	if(!P.lids().empty()) {
+		auto root = P.is_absolute() ? find_root(start) : (start ? start.data_node(unsafe) : node::nil());
+		if(auto levels = detail::deref_registered(P.lids(), root); !levels.empty()) {
+			auto res_path = std::vector<std::string>{};
+			res_path.reserve(P.parts().size());
+			if(P.is_absolute()) res_path.emplace_back();
+			for(const auto& L : levels)
+				res_path.push_back(link2path_unit(L, dst_path_unit));
+			return boost::join(res_path, "/");
+		}
+	}
+
 	std::vector<std::string> res_path;
 	const auto converter = [&res_path, src_path_unit, dst_path_unit](
 		std::string_view next_level, const node& cur_level
@@ -255,8 +722,7 @@ std::string convert_path(
 	};
 
 	// do conversion
-	boost::trim(src_path);
-	if(detail::deref_path_impl<true>(src_path, std::move(start), node::nil(), opts, converter)) {
+	if(detail::deref_parts_impl<true>(P.parts(), std::move(start), node::nil(), opts, converter)) {
 		return boost::join(res_path, "/");
 	}
 	return "";
@@ -265,20 +731,167 @@ std::string convert_path(
 ///////////////////////////////////////////////////////////////////////////////
 //  deref_path
 //
+NAMESPACE_BEGIN()
+
+// max number of cached absolute paths
+// [NOTE] config value is read once on first deref
+auto path_cache_capacity() -> std::size_t {
+	static const auto capacity = std::size_t(
+		get_or(kernel::config::config(), "tree.path_cache_capacity", std::uint32_t{4096})
+	);
+	return capacity;
+}
+
+// paths of OIDs & object types can be changed by data modification that doesn't touch nodes
+constexpr auto is_cacheable(Key path_unit) -> bool {
+	return path_unit == Key::ID || path_unit == Key::Name;
+}
+
+// options that affect path resolution & are part of cache key
+constexpr auto deref_opts_mask = TreeOpts::FollowSymLinks | TreeOpts::FollowLazyLinks;
+
+// LRU cache: (root node, path unit, deref options, absolute path) -> trace of resolved path
+// [NOTE] entries aren't removed on tree modifications, instead they're checked on lookup
+// using node epochs that are bumped on same modifications that fire node events
+struct path_cache {
+	using sp_path_trace = detail::sp_path_trace;
+	using lru_list = std::list<std::pair<std::string, sp_path_trace>>;
+
+	static auto get() -> path_cache& {
+		// leaked intentionally, can be accessed from actors during shutdown
+		static auto* self = new path_cache();
+		return *self;
+	}
+
+	static auto make_key(const node& root, Key path_unit, TreeOpts opts, std::string_view path)
+	-> std::string {
+		const auto root_id = root.home_id();
+		const auto opts_id = std::to_string(enumval(opts & deref_opts_mask));
+		auto res = std::string{};
+		res.reserve(root_id.size() + opts_id.size() + path.size() + 3);
+		res.append(root_id).push_back('/');
+		res.push_back(char('0' + int(path_unit)));
+		res.append(opts_id).push_back(':');
+		res.append(path);
+		return res;
+	}
+
+	auto find(const node& root, Key path_unit, TreeOpts opts, std::string_view path) -> link {
+		const auto key = make_key(root, path_unit, opts, path);
+		auto T = sp_path_trace{};
+		{
+			auto guard = std::lock_guard{guard_};
+			auto pos = index_.find(key);
+			if(pos == index_.end()) return {};
+			// move entry to front
+			lru_.splice(lru_.begin(), lru_, pos->second);
+			T = pos->second->second;
+		}
+		if(auto res = T->lock())
+			return res;
+		// drop outdated entry
+		auto guard = std::lock_guard{guard_};
+		if(auto pos = index_.find(key); pos != index_.end() && pos->second->second == T) {
+			lru_.erase(pos->second);
+			index_.erase(pos);
+		}
+		return {};
+	}
+
+	auto put(const node& root, Key path_unit, TreeOpts opts, std::string_view path, sp_path_trace T)
+	-> void {
+		if(!T) return;
+		auto key = make_key(root, path_unit, opts, path);
+		auto guard = std::lock_guard{guard_};
+		if(auto pos = index_.find(key); pos != index_.end()) {
+			pos->second->second = std::move(T);
+			lru_.splice(lru_.begin(), lru_, pos->second);
+			return;
+		}
+		lru_.emplace_front(key, std::move(T));
+		index_.emplace(std::move(key), lru_.begin());
+		// evict least recently used entry
+		if(lru_.size() > path_cache_capacity()) {
+			index_.erase(lru_.back().first);
+			lru_.pop_back();
+		}
+	}
+
+private:
+	std::mutex guard_;
+	lru_list lru_;
+	std::unordered_map<std::string, lru_list::iterator> index_;
+};
+
+// resolve compiled path, `root` is either absolute path root or relative path start node
+// resolved absolute paths are put into cache, `lookup_cache` = false skips cache lookup
+auto deref_compiled(
+	const compiled_path& P, link start, node root, TreeOpts opts, bool lookup_cache = true
+) -> link {
+	if(P.parts().empty()) return {};
+	const auto prio = detail::interactive_scope(opts);
+	const auto use_cache = P.is_absolute() && P.is_plain() && is_cacheable(P.path_unit())
+		&& path_cache_capacity();
+	if(P.is_absolute()) {
+		root = root ? find_root(root) : find_root(start);
+		if(!root) return {};
+		if(use_cache && lookup_cache) {
+			if(auto res = path_cache::get().find(root, P.path_unit(), opts, P.str()))
+				return res;
+		}
+	}
+
+	const auto start_epoch = node_impl::tree_epoch();
+	auto res = link{};
+	// plain paths of link IDs are resolved via links registry
+	if(!P.lids().empty()) {
+		const auto id_root = root ? root : (start ? start.data_node(unsafe) : node::nil());
+		if(auto levels = detail::deref_registered(P.lids(), id_root); !levels.empty())
+			res = levels.back();
+	}
+	if(!res)
+		res = detail::deref_parts_impl(
+			P.parts(), std::move(start), root, opts, detail::gen_walk_down_tree(P.path_unit())
+		);
+
+	if(res && use_cache)
+		path_cache::get().put(root, P.path_unit(), opts, P.str(), detail::path_trace::make(
+			res, P.parts().size() - 1, root, true, start_epoch
+		));
+	return res;
+}
+
+// lookup cache first to skip path compilation
+auto deref_string(const std::string& path, link start, node root, Key path_unit, TreeOpts opts) -> link {
+	if(!path.empty() && path.front() == '/' && is_cacheable(path_unit) && path_cache_capacity()) {
+		root = root ? find_root(root) : find_root(start);
+		if(!root) return {};
+		if(auto res = path_cache::get().find(root, path_unit, opts, path))
+			return res;
+	}
+	return deref_compiled(compiled_path(path, path_unit), std::move(start), std::move(root), opts, false);
+}
+
+NAMESPACE_END()
+
 auto deref_path(
 	const std::string& path, link start, Key path_unit, TreeOpts opts
 ) -> link {
-	return detail::deref_path_impl(
-		path, std::move(start), node::nil(), opts, detail::gen_walk_down_tree(path_unit)
-	);
+	return deref_string(path, std::move(start), node::nil(), path_unit, opts);
 }
 
 auto deref_path(
 	const std::string& path, node start, Key path_unit, TreeOpts opts
 ) -> link {
-	return detail::deref_path_impl(
-		path, {}, std::move(start), opts, detail::gen_walk_down_tree(path_unit)
-	);
+	return deref_string(path, {}, std::move(start), path_unit, opts);
+}
+
+auto deref_path(const compiled_path& path, link start, TreeOpts opts) -> link {
+	return deref_compiled(path, std::move(start), node::nil(), opts);
+}
+
+auto deref_path(const compiled_path& path, node start, TreeOpts opts) -> link {
+	return deref_compiled(path, {}, std::move(start), opts);
 }
 
 auto deref_path(
@@ -286,7 +899,7 @@ auto deref_path(
 ) -> void {
 
 	auto work = [=, f = std::move(f), path = std::move(path)]() {
-		f(detail::deref_path_impl(path, start, node::nil(), opts, detail::gen_walk_down_tree(path_unit)));
+		f(deref_path(path, start, path_unit, opts));
 	};
 
 	kernel::radio::system().spawn(std::move(work));
@@ -299,6 +912,13 @@ auto walk(link root, walk_links_fv step_f, TreeOpts opts) -> void {
 	walk_impl({root}, step_f, opts);
 }
 
+auto walk(
+	link root, walk_links_fv step_f, TreeOpts opts, bool serial_steps, std::size_t n_workers
+) -> void {
+	if(!n_workers) n_workers = std::thread::hardware_concurrency();
+	parallel_walker(step_f, opts, serial_steps, n_workers).run(std::move(root));
+}
+
 auto walk(const node& root, walk_links_fv step_f, TreeOpts opts) -> void {
 	if(!root) return;
 	auto hr = root.handle();
@@ -310,6 +930,40 @@ auto walk(node root, walk_nodes_fv step_f, TreeOpts opts) -> void {
 	walk_impl({std::move(root)}, step_f, opts);
 }
 
+auto detail::walk(const std::list<link>& roots, walk_links_fv step_f, TreeOpts opts) -> void {
+	walk_impl(roots, step_f, opts);
+}
+
+auto walk(
+	launch_async_t, link root, walk_batch_f f, std::size_t batch_size, TreeOpts opts
+) -> void {
+	kernel::radio::system().spawn<caf::detached>(
+		[root = std::move(root), f = std::move(f), batch_size, opts] {
+			walk_batches(root, f, batch_size, opts);
+			// signal end of walk
+			f(node::nil(), {});
+		}
+	);
+}
+
+auto walk(
+	launch_async_t, link root, caf::actor consumer, std::size_t batch_size, TreeOpts opts
+) -> void {
+	kernel::radio::system().spawn<caf::detached>(
+		[root = std::move(root), consumer = std::move(consumer), batch_size, opts] {
+			auto self = caf::scoped_actor{kernel::radio::system()};
+			const auto send_batch = [&](node N, links_v batch) {
+				return actorf<bool>(
+					self, consumer, kernel::radio::timeout(true), a_apply(), std::move(N), std::move(batch)
+				).value_or(false);
+			};
+			walk_batches(root, send_batch, batch_size, opts);
+			// signal end of walk
+			send_batch(node::nil(), {});
+		}
+	);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //  misc
 //
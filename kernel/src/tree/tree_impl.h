@@ -7,10 +7,13 @@
 #pragma once
 
 #include <bs/tree/tree.h>
+#include <bs/kernel/radio.h>
 #include <bs/detail/enumops.h>
 
 #include <boost/algorithm/string.hpp>
 
+#include <atomic>
+
 NAMESPACE_BEGIN(blue_sky::tree::detail)
 using namespace std::string_view_literals;
 
@@ -26,6 +29,24 @@ inline auto gen_walk_down_tree(Key path_unit = Key::ID) {
 	};
 }
 
+// walk several subtrees at once (roots are processed in given order)
+auto walk(const std::list<link>& roots, walk_links_fv step_f, TreeOpts opts = def_walk_opts) -> void;
+
+/*-----------------------------------------------------------------------------
+ *  tree-wide links registry: link ID -> weak refs to all started links with that ID
+ *-----------------------------------------------------------------------------*/
+// add started link to registry
+auto register_link(const link& L) -> void;
+// drop expired registry entries for given ID
+auto unregister_link(const lid_type& lid) -> void;
+// alive links with given ID (more than one only if tree copies share IDs, ex. after load)
+auto registered_links(const lid_type& lid) -> links_v;
+// find link with given ID inside `root` subtree: registry lookup + ancestry check
+auto find_registered(const lid_type& lid, const node& root) -> link;
+// resolve path of IDs relative to `root` via registry
+// returns links for each path element or empty vector if path can't be resolved
+auto deref_registered(const lids_v& path, const node& root) -> links_v;
+
 // find out if we can call `data_node()` honoring LazyLoad flag
 inline auto can_call_dnode(const link& L, TreeOpts opts) -> bool {
 	using namespace allow_enumops;
@@ -34,36 +55,64 @@ inline auto can_call_dnode(const link& L, TreeOpts opts) -> bool {
 		|| !(L.flags() & LazyLoad);
 }
 
+// requests made by calling thread are interactive if `opts` contain `HighPriority`
+inline auto interactive_scope(TreeOpts opts) {
+	using namespace allow_enumops;
+	return kernel::radio::interactive_scope{enumval(opts & TreeOpts::HighPriority)};
+}
+
+/*-----------------------------------------------------------------------------
+ *  trace of resolved path that stays valid while nodes along the path aren't modified
+ *-----------------------------------------------------------------------------*/
+struct path_trace {
+	link::weak_ptr target;
+	// node path was resolved from (for ex. sym link owner)
+	node::weak_ptr origin;
+	// nodes met going up from target to path start & their modification epochs
+	std::vector<std::pair<node::weak_ptr, std::uint64_t>> nodes;
+	bool is_absolute = false;
+	// tree epoch of last successful check
+	std::atomic<std::uint64_t> tree_epoch = 0;
+
+	// trace `target` that was resolved by plain path of `depth` elements starting from `start` node
+	// returns nullptr if target isn't reachable from `start` or tree was modified since `start_epoch`
+	// (taken from `node_impl::tree_epoch()` before resolving path)
+	static auto make(
+		const link& target, std::size_t depth, const node& start, bool is_absolute,
+		std::uint64_t start_epoch
+	) -> std::shared_ptr<path_trace>;
+
+	// returns target if trace is still valid, nil link otherwise
+	auto lock() -> link;
+};
+using sp_path_trace = std::shared_ptr<path_trace>;
+
 // If `DerefControlElements` == true, processing function will be invoked for all path parts
 // including ".", ".." and empty part (root handle)
+// `path_parts` is a range of path elements convertible to `std::string_view`
 template<
 	bool DerefControlElements = false,
+	typename PathParts,
 	typename level_deref_f = decltype(gen_walk_down_tree())
 >
-auto deref_path_impl(
-	std::string_view path, link L, node root = node::nil(), TreeOpts opts = TreeOpts::Nil,
+auto deref_parts_impl(
+	const PathParts& path_parts, link L, node root = node::nil(), TreeOpts opts = TreeOpts::Nil,
 	level_deref_f deref_f = gen_walk_down_tree()
 ) -> link {
 	using namespace allow_enumops;
 	using namespace std::string_view_literals;
 
-	// split path into elements
-	if(path.empty()) return {};
-	auto path_parts = std::vector< std::pair<std::string_view::const_iterator, std::string_view::const_iterator> >{};
-	boost::split(path_parts, path, boost::is_any_of("/"));
-
+	if(path_parts.empty()) return {};
 	// setup search root
-	if(path_parts[0].first == path_parts[0].second) {
+	if(std::string_view{path_parts[0]}.empty()) {
 		// absolute path case
 		root = root ? find_root(root) : find_root(L);
 	}
 	if(root) L = root.handle();
 
 	// deref each element
-	for(const auto& part_tok : path_parts) {
-		const auto part = std::string_view{
-			&*part_tok.first, static_cast<std::size_t>(part_tok.second - part_tok.first)
-		};
+	for(const auto& part_el : path_parts) {
+		const auto part = std::string_view{part_el};
 		bool is_control_elem = false;
 		if(part.empty() || part == "."sv)
 			is_control_elem = true;
@@ -90,4 +139,26 @@ auto deref_path_impl(
 	return L;
 }
 
+// same as above, but splits path string into elements first
+template<
+	bool DerefControlElements = false,
+	typename level_deref_f = decltype(gen_walk_down_tree())
+>
+auto deref_path_impl(
+	std::string_view path, link L, node root = node::nil(), TreeOpts opts = TreeOpts::Nil,
+	level_deref_f deref_f = gen_walk_down_tree()
+) -> link {
+	// split path into elements
+	if(path.empty()) return {};
+	auto path_toks = std::vector< std::pair<std::string_view::const_iterator, std::string_view::const_iterator> >{};
+	boost::split(path_toks, path, boost::is_any_of("/"));
+	auto path_parts = std::vector<std::string_view>{};
+	path_parts.reserve(path_toks.size());
+	for(const auto& [b, e] : path_toks)
+		path_parts.emplace_back(path.data() + (b - path.begin()), static_cast<std::size_t>(e - b));
+	return deref_parts_impl<DerefControlElements>(
+		path_parts, std::move(L), std::move(root), opts, std::move(deref_f)
+	);
+}
+
 NAMESPACE_END(blue_sky::tree::detail)
@@ -14,10 +14,13 @@
 
 #include <bs/log.h>
 #include <bs/propdict.h>
+#include <bs/kernel/config.h>
 #include <bs/kernel/kernel.h>
+#include <bs/kernel/radio.h>
 #include <bs/kernel/tools.h>
 #include <bs/kernel/types_factory.h>
 #include <bs/tree/tree.h>
+#include <bs/tree/query.h>
 
 #include <bs/serialize/base_types.h>
 #include <bs/serialize/array.h>
@@ -27,10 +30,16 @@
 #include <boost/test/unit_test.hpp>
 #include <caf/scoped_actor.hpp>
 
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <future>
+#include <mutex>
+#include <unordered_map>
 
 using namespace blue_sky;
 using namespace blue_sky::log;
@@ -71,8 +80,407 @@ auto make_persons_tree() -> tree::link {
 	return link::make_root<hard_link>("r", std::move(N));
 }
 
+// poll `pred` until it returns true or `deadline` expires
+template<typename F>
+auto wait_until(F&& pred, std::chrono::milliseconds deadline = 5s) -> bool {
+	const auto stop = std::chrono::steady_clock::now() + deadline;
+	while(!pred()) {
+		if(std::chrono::steady_clock::now() >= stop) return false;
+		std::this_thread::sleep_for(1ms);
+	}
+	return true;
+}
+
 NAMESPACE_END(blue_sky)
 
+BOOST_AUTO_TEST_CASE(test_tree_extraidx) {
+	auto N = node();
+	auto persons = links_v{};
+	for(int i = 0; i < 3; ++i) {
+		persons.push_back(hard_link(
+			"person_" + std::to_string(i),
+			kernel::tfactory::create_object("bs_person", "person_" + std::to_string(i), double(i))
+		));
+		N.insert(persons.back());
+	}
+	const auto plain = hard_link("plain", std::make_shared<objbase>());
+	N.insert(plain);
+	// sym link keys are fetched asynchronously
+	const auto sym = sym_link("sym_person", persons[0]);
+	N.insert(sym);
+
+	// first query by object type builds index, next ones are served from it
+	const auto person_type = bs_person::bs_type().name;
+	BOOST_TEST(wait_until([&] { return N.equal_range(person_type, Key::Type).size() == 4; }));
+	for(const auto& L : persons) {
+		const auto by_oid = N.equal_range(L.data(unsafe)->id(), Key::OID);
+		BOOST_TEST(by_oid.size() == (L == persons[0] ? 2 : 1));
+		BOOST_TEST((std::find(by_oid.begin(), by_oid.end(), L) != by_oid.end()));
+	}
+	BOOST_TEST((N.find(plain.data(unsafe)->id(), Key::OID) == plain));
+	BOOST_TEST(N.equal_range(objbase::bs_type().name, Key::Type).size() == 1);
+
+	// index follows erase & clear
+	N.erase(persons[1].id());
+	BOOST_TEST(N.equal_range(person_type, Key::Type).size() == 3);
+	BOOST_TEST(N.equal_range(persons[1].data(unsafe)->id(), Key::OID).empty());
+	N.clear();
+	BOOST_TEST(N.equal_range(person_type, Key::Type).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_bulk_insert) {
+	auto N = node();
+	const auto first = hard_link("first", std::make_shared<objbase>());
+	N.insert(first);
+
+	auto bulk_ev = std::make_shared<std::promise<prop::propdict>>();
+	N.subscribe([=](node, event ev) {
+		if(prop::get_if<lids_v>(&ev.params, "lids"))
+			bulk_ev->set_value(std::move(ev.params));
+	}, Event::LinkInserted);
+
+	// link with duplicating name is denied, so it's skipped in reported IDs & positions
+	const auto L0 = hard_link("bulk_0", std::make_shared<objbase>());
+	const auto dup = hard_link("first", std::make_shared<objbase>());
+	const auto L1 = hard_link("bulk_1", std::make_shared<objbase>());
+	BOOST_TEST(N.insert(links_v{L0, dup, L1}, InsertPolicy::DenyDupNames) == 2);
+	BOOST_TEST(N.size() == 3);
+	BOOST_TEST(!dup.owner());
+	BOOST_TEST((L1.owner() == N));
+
+	auto bulk_f = bulk_ev->get_future();
+	BOOST_TEST((bulk_f.wait_for(5s) == std::future_status::ready));
+	const auto params = bulk_f.get();
+	BOOST_TEST(prop::get<lids_v>(params, "lids") == (lids_v{L0.id(), L1.id()}), boost::test_tools::per_element());
+	BOOST_TEST(
+		prop::get<prop::list_of<prop::integer>>(params, "positions") == (prop::list_of<prop::integer>{1, 2}),
+		boost::test_tools::per_element()
+	);
+	BOOST_TEST(*N.index(L1.id()) == 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_snapshot) {
+	auto N = node();
+	for(int i = 0; i < 3; ++i)
+		N.insert(hard_link("leaf_" + std::to_string(i), std::make_shared<objbase>()));
+	// mutation drops snapshot, first read after it publishes new one
+	const auto L = hard_link("new_leaf", std::make_shared<objbase>());
+	N.insert(L);
+	BOOST_TEST(N.size() == 4);
+
+	// occupy node actor, so reads below can only be served from snapshot
+	auto started = std::make_shared<std::promise<void>>();
+	auto release = std::make_shared<std::promise<void>>();
+	auto released = release->get_future().share();
+	N.apply(launch_async, [=](bare_node) {
+		started->set_value();
+		released.wait();
+		return perfect;
+	});
+	BOOST_TEST((started->get_future().wait_for(5s) == std::future_status::ready));
+	BOOST_TEST(N.size() == 4);
+	BOOST_TEST((N.find(L.id()) == L));
+	BOOST_TEST((N.find(3) == L));
+	BOOST_TEST(*N.index(L.id()) == 3);
+	release->set_value();
+
+	// next mutation is visible to reads
+	N.erase(L.id());
+	BOOST_TEST(N.size() == 3);
+	BOOST_TEST(!N.find(L.id()));
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_erase) {
+	auto N = node();
+	auto sub = node();
+	for(int i = 0; i < 2; ++i)
+		sub.insert(hard_link("sub_leaf_" + std::to_string(i), std::make_shared<objbase>()));
+	const auto sub_L = hard_link("sub", sub);
+	const auto leaf_0 = hard_link("leaf_0", std::make_shared<objbase>());
+	const auto leaf_1 = hard_link("leaf_1", std::make_shared<objbase>());
+	N.insert(links_v{sub_L, leaf_0, leaf_1});
+
+	// log sizes of erase events, inserted marker leafs signal that preceding events are delivered
+	struct erase_log {
+		std::mutex guard;
+		std::vector<std::size_t> erased;
+		std::unordered_map<lid_type, std::promise<void>> markers;
+	};
+	auto log = std::make_shared<erase_log>();
+	const auto marker_0 = hard_link("marker_0", std::make_shared<objbase>());
+	const auto marker_1 = hard_link("marker_1", std::make_shared<objbase>());
+	auto marker_0_done = log->markers[marker_0.id()].get_future();
+	auto marker_1_done = log->markers[marker_1.id()].get_future();
+	N.subscribe([=](node, event ev) {
+		auto guard = std::lock_guard{log->guard};
+		if(ev.code == Event::LinkErased)
+			log->erased.push_back(prop::get<lids_v>(ev.params, "lids").size());
+		else if(auto p = log->markers.find(prop::get<lid_type>(ev.params, "link_id")); p != log->markers.end())
+			p->second.set_value();
+	}, Event::LinkInserted | Event::LinkErased);
+
+	// batch erase sends single ack with IDs of whole erased subtree
+	BOOST_TEST(N.erase(lids_v{leaf_0.id(), sub_L.id()}) == 2);
+	N.insert(marker_0);
+	BOOST_TEST((marker_0_done.wait_for(5s) == std::future_status::ready));
+	{
+		auto guard = std::lock_guard{log->guard};
+		BOOST_TEST(log->erased == std::vector<std::size_t>{4});
+	}
+
+	// deferred erase ack isn't overtaken by next insert ack
+	N.erase(launch_async, lids_v{leaf_1.id()});
+	N.insert(marker_1);
+	BOOST_TEST((marker_1_done.wait_for(5s) == std::future_status::ready));
+	{
+		auto guard = std::lock_guard{log->guard};
+		BOOST_TEST(log->erased == (std::vector<std::size_t>{4, 1}));
+	}
+	BOOST_TEST(N.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_deep_search) {
+	// tree with several levels of subtrees
+	auto deep_N = node();
+	for(int i = 0; i < 4; ++i) {
+		auto sub_N = node();
+		for(int j = 0; j < 3; ++j) {
+			auto subsub_N = node();
+			subsub_N.insert(hard_link("deep_leaf", std::make_shared<objbase>()));
+			sub_N.insert(hard_link("subsub_" + std::to_string(j), std::move(subsub_N)));
+		}
+		sub_N.insert(hard_link("deep_leaf", std::make_shared<objbase>()));
+		deep_N.insert(hard_link("sub_" + std::to_string(i), std::move(sub_N)));
+	}
+
+	// concurrent fan-out finds same leafs as sequential search
+	const auto seq_res = deep_N.deep_equal_range("deep_leaf", Key::Name);
+	BOOST_TEST(seq_res.size() == 16);
+
+	// set number of child subtrees searched concurrently, previous value is restored on exit
+	struct parallelism_guard {
+		std::optional<caf::config_value> prev;
+
+		parallelism_guard(std::int64_t n) :
+			prev(kernel::config::set("tree.deep_search_parallelism", caf::config_value{n}))
+		{}
+		~parallelism_guard() {
+			kernel::config::set("tree.deep_search_parallelism", std::move(prev));
+		}
+	};
+	const auto par_guard = parallelism_guard{4};
+
+	auto par_res = deep_N.deep_equal_range("deep_leaf", Key::Name);
+	BOOST_TEST(par_res.size() == seq_res.size());
+	BOOST_TEST(std::is_permutation(par_res.begin(), par_res.end(), seq_res.begin(), seq_res.end()));
+	BOOST_TEST(deep_N.deep_search("deep_leaf", Key::Name));
+	BOOST_TEST(!deep_N.deep_search("no_such_leaf", Key::Name));
+	BOOST_TEST(deep_N.deep_equal_range("no_such_leaf", Key::Name).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_path_cache) {
+	auto root = node();
+	auto sub = node();
+	const auto sub_L = hard_link("sub", sub);
+	root.insert(sub_L);
+	const auto leaf = hard_link("leaf", std::make_shared<objbase>());
+	sub.insert(leaf);
+
+	// repeated derefs are served from cache
+	const auto name_path = abspath(leaf, Key::Name);
+	const auto id_path = abspath(leaf);
+	BOOST_TEST(name_path == "/sub/leaf");
+	for(int i = 0; i < 2; ++i) {
+		BOOST_TEST((deref_path(name_path, root, Key::Name) == leaf));
+		BOOST_TEST((deref_path(id_path, root) == leaf));
+		BOOST_TEST((deref_path(compiled_path(name_path, Key::Name), root) == leaf));
+	}
+
+	// cached entry is invalidated by rename of leaf or it's ancestor
+	leaf.rename("renamed_leaf");
+	BOOST_TEST(!deref_path(name_path, root, Key::Name));
+	BOOST_TEST((deref_path("/sub/renamed_leaf", root, Key::Name) == leaf));
+	BOOST_TEST((deref_path(id_path, root) == leaf));
+	leaf.rename("leaf");
+	BOOST_TEST((deref_path(name_path, root, Key::Name) == leaf));
+	sub_L.rename("renamed_sub");
+	BOOST_TEST(!deref_path(name_path, root, Key::Name));
+	sub_L.rename("sub");
+	BOOST_TEST((deref_path(name_path, root, Key::Name) == leaf));
+
+	// ... and by erase, same path then resolves to new link
+	sub.erase(leaf.id());
+	BOOST_TEST(!deref_path(name_path, root, Key::Name));
+	BOOST_TEST(!deref_path(id_path, root));
+	const auto new_leaf = hard_link("leaf", std::make_shared<objbase>());
+	sub.insert(new_leaf);
+	BOOST_TEST((deref_path(name_path, root, Key::Name) == new_leaf));
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_lazy_actor) {
+	// engine's actor is spawned on first access
+	auto N = node();
+	BOOST_TEST(!N.has_actor());
+	const auto L = hard_link("lazy_leaf", std::make_shared<objbase>());
+	BOOST_TEST(!L.has_actor());
+	N.insert(L);
+	BOOST_TEST(N.has_actor());
+	BOOST_TEST(N.size() == 1);
+	// unsubscribing passive engine doesn't start it
+	auto passive_N = node();
+	passive_N.unsubscribe();
+	BOOST_TEST(!passive_N.has_actor());
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_passive_link_acks) {
+	// in sharded mode link transactions are executed by shards, so leafs actors aren't spawned
+	// set number of shards, previous value is restored on exit
+	struct shards_guard {
+		std::optional<caf::config_value> prev;
+
+		shards_guard(std::int64_t n) :
+			prev(kernel::config::set("tree.link_shards", caf::config_value{n}))
+		{
+			kernel::radio::restart_link_shards();
+		}
+		~shards_guard() {
+			kernel::config::set("tree.link_shards", std::move(prev));
+			kernel::radio::restart_link_shards();
+		}
+	};
+	const auto shards = shards_guard{2};
+
+	auto N = node();
+	const auto leaf = hard_link("passive_leaf", std::make_shared<objbase>());
+	N.insert(leaf);
+	const auto old_oid = leaf.data(unsafe)->id();
+	BOOST_TEST((N.find(old_oid, Key::OID) == leaf));
+
+	// acks of passive leaf are delivered to owner node & produce events
+	auto renamed = std::make_shared<std::promise<std::string>>();
+	auto loaded = std::make_shared<std::promise<void>>();
+	N.subscribe([=](node, event ev) {
+		if(ev.code == Event::LinkRenamed)
+			renamed->set_value(prop::get<std::string>(ev.params, "new_name"));
+		else if(
+			ev.code == Event::LinkStatusChanged &&
+			prop::get<prop::integer>(ev.params, "new_status") == prop::integer(ReqStatus::OK)
+		)
+			loaded->set_value();
+	}, Event::All);
+
+	N.rename(leaf.id(), "passive_renamed");
+	BOOST_TEST(renamed->get_future().get() == "passive_renamed");
+
+	// pointee changes, index is refreshed after leaf's data status becomes OK
+	auto new_obj = objbase("passive_oid");
+	leaf.data(unsafe)->swap(new_obj);
+	leaf.rs_reset(Req::Data, ReqStatus::Void);
+	leaf.rs_reset(Req::Data, ReqStatus::OK);
+	loaded->get_future().get();
+	BOOST_TEST(wait_until([&] { return N.find("passive_oid", Key::OID) == leaf; }));
+	BOOST_TEST(!N.find(old_oid, Key::OID));
+	BOOST_TEST(!leaf.has_actor());
+	N.unsubscribe();
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_stats) {
+	auto N = node();
+	auto subs = std::vector<node>{};
+	for(int i = 0; i < 4; ++i) {
+		auto sub_N = subs.emplace_back();
+		sub_N.insert(hard_link("leaf", std::make_shared<objbase>()));
+		N.insert(hard_link("sub_" + std::to_string(i), std::move(sub_N)));
+	}
+
+	// subtree stats are counted once, then maintained from acks
+	const auto stats = N.stats();
+	BOOST_TEST(stats.leafs == 8);
+	BOOST_TEST(stats.nodes == 4);
+
+	const auto person_type = bs_person::bs_type().name;
+	subs[0].insert(hard_link("person", kernel::tfactory::create_object(person_type, std::string("Tyler"), 33.)));
+	BOOST_TEST(wait_until([&] { return N.stats().leafs == 9; }));
+	const auto deep_stats = N.stats();
+	BOOST_TEST(deep_stats.nodes == 4);
+	BOOST_TEST(deep_stats.types.at(person_type) == 1);
+
+	subs[0].erase("person", Key::Name);
+	BOOST_TEST(wait_until([&] { return N.stats().leafs == 8; }));
+	BOOST_TEST(!N.stats().types.count(person_type));
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_event_batch) {
+	// coalesced events are delivered as single batch
+	// [NOTE] timer is disabled, so batches are delivered only by events count
+	auto N = node();
+	auto batches = std::make_shared<std::array<std::promise<lids_v>, 2>>();
+	auto n_batches = std::make_shared<std::atomic<std::size_t>>(0);
+	N.subscribe([=](node, event ev) {
+		if(const auto i = (*n_batches)++; i < batches->size())
+			(*batches)[i].set_value(prop::get<lids_v>(ev.params, "lids"));
+	}, Event::LinkInserted, event_batch_opts{timespan::zero(), 3});
+
+	const auto insert_batch = [&] {
+		auto lids = lids_v{};
+		for(int i = 0; i < 3; ++i) {
+			const auto L = hard_link("batch_" + std::to_string(i), std::make_shared<objbase>());
+			N.insert(L);
+			lids.push_back(L.id());
+		}
+		return lids;
+	};
+	// 2nd batch contains only new links => 1st batch was delivered exactly once
+	const auto lids1 = insert_batch();
+	BOOST_TEST((*batches)[0].get_future().get() == lids1, boost::test_tools::per_element());
+	const auto lids2 = insert_batch();
+	BOOST_TEST((*batches)[1].get_future().get() == lids2, boost::test_tools::per_element());
+	BOOST_TEST(n_batches->load() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_shallow_subscriber) {
+	auto N = node();
+	auto sub = node();
+	N.insert(hard_link("sub", sub));
+	const auto deep_leaf = hard_link("deep_leaf", std::make_shared<objbase>());
+	const auto direct_leaf = hard_link("direct_leaf", std::make_shared<objbase>());
+	const auto marker = hard_link("marker", std::make_shared<objbase>());
+
+	// log IDs of inserted links seen by subscriber & signal when expected link is seen
+	struct insert_log {
+		std::mutex guard;
+		lids_v seen;
+		std::unordered_map<lid_type, std::promise<void>> waiters;
+	};
+	const auto make_cb = [](std::shared_ptr<insert_log> log) {
+		return [=](node, event ev) {
+			const auto lid = prop::get<lid_type>(ev.params, "link_id");
+			auto guard = std::lock_guard{log->guard};
+			log->seen.push_back(lid);
+			if(auto p = log->waiters.find(lid); p != log->waiters.end())
+				p->second.set_value();
+		};
+	};
+	auto deep_log = std::make_shared<insert_log>();
+	auto deep_done = deep_log->waiters[deep_leaf.id()].get_future();
+	auto shallow_log = std::make_shared<insert_log>();
+	auto marker_done = shallow_log->waiters[marker.id()].get_future();
+	N.subscribe(make_cb(deep_log), Event::LinkInserted);
+	N.subscribe(make_cb(shallow_log), Event::LinkInserted, {}, TreeOpts::Nil);
+
+	sub.insert(deep_leaf);
+	N.insert(direct_leaf);
+	// when deep subscriber gets deep event, it's already enqueued to all subscribers of node,
+	// so marker inserted after that is delivered to shallow subscriber after possible deep event
+	BOOST_TEST((deep_done.wait_for(5s) == std::future_status::ready));
+	N.insert(marker);
+	BOOST_TEST((marker_done.wait_for(5s) == std::future_status::ready));
+
+	// shallow subscriber receives only events of direct leafs
+	auto guard = std::lock_guard{shallow_log->guard};
+	BOOST_TEST(shallow_log->seen == (lids_v{direct_leaf.id(), marker.id()}), boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE(test_tree) {
 	std::cout << "\n\n*** testing tree..." << std::endl;
 	std::cout << "*********************************************************************" << std::endl;
@@ -95,6 +503,118 @@ BOOST_AUTO_TEST_CASE(test_tree) {
 	) << bs_end;
 	kernel::tools::print_link(hN, false);
 
+	// paged access returns window of sorted leafs
+	const auto by_name = N.keys(Key::Name);
+	const auto page = N.keys(Key::Name, 2, 3);
+	BOOST_TEST(page.size() == 3);
+	BOOST_TEST(std::equal(page.begin(), page.end(), by_name.begin() + 2));
+	BOOST_TEST(N.leafs(Key::AnyOrder, N.size() - 1, 10).size() == 1);
+
+	// bulk insert keeps order of inserted links
+	auto bulk_src = links_v{};
+	for(int i = 0; i < 5; ++i)
+		bulk_src.push_back(hard_link("bulk_" + std::to_string(i), std::make_shared<objbase>()));
+	auto bulk_N = node();
+	BOOST_TEST(bulk_N.insert(links_v(bulk_src)) == bulk_src.size());
+	const auto bulk_lids = bulk_N.keys();
+	for(std::size_t i = 0; i < bulk_src.size(); ++i)
+		BOOST_TEST(bulk_lids[i] == bulk_src[i].id());
+	// batched erase
+	BOOST_TEST(bulk_N.erase(lids_v{bulk_lids[0], bulk_lids[2], bulk_lids[0]}) == 2);
+	BOOST_TEST(bulk_N.size() == bulk_src.size() - 2);
+	// full leafs read publishes snapshot that serves next reads directly
+	const auto bulk_leafs = bulk_N.leafs();
+	BOOST_TEST(bulk_N.size() == bulk_leafs.size());
+	BOOST_TEST(bulk_N.find(bulk_lids[1]).id() == bulk_lids[1]);
+	BOOST_TEST(*bulk_N.index(bulk_lids[1]) == 0);
+	// and snapshot is dropped after modification
+	bulk_N.erase(bulk_lids[1]);
+	BOOST_TEST(!bulk_N.find(bulk_lids[1]));
+
+	// deep search collects matches from all child subtrees
+	auto deep_N = node();
+	for(int i = 0; i < 4; ++i) {
+		auto sub_N = node();
+		sub_N.insert(hard_link("deep_leaf", std::make_shared<objbase>()));
+		deep_N.insert(hard_link("sub_" + std::to_string(i), std::move(sub_N)));
+	}
+	BOOST_TEST(deep_N.deep_equal_range("deep_leaf", Key::Name).size() == 4);
+	BOOST_TEST(deep_N.deep_search("deep_leaf", Key::Name));
+	BOOST_TEST(!deep_N.deep_search("no_such_leaf", Key::Name));
+	// link IDs are resolved via tree-wide registry
+	const auto deep_leaf = deep_N.deep_search("deep_leaf", Key::Name);
+	BOOST_TEST((deep_N.deep_search(deep_leaf.id()) == deep_leaf));
+	BOOST_TEST((deref_path(abspath(deep_leaf), deep_N) == deep_leaf));
+	BOOST_TEST(!bulk_N.deep_search(deep_leaf.id()));
+	// compiled paths are resolved to same links, repeated derefs are served from cache
+	const auto deep_cpath = compiled_path(abspath(deep_leaf));
+	BOOST_TEST(deep_cpath.is_plain());
+	BOOST_TEST(deep_cpath.lids().size() == 2);
+	BOOST_TEST((deref_path(deep_cpath, deep_N) == deep_leaf));
+	BOOST_TEST((deref_path(deep_cpath, deep_N) == deep_leaf));
+	BOOST_TEST((deref_path(compiled_path(abspath(deep_leaf, Key::Name), Key::Name), deep_N) == deep_leaf));
+	// cached abspaths follow renames of ancestors
+	const auto deep_sub = deep_N.find("sub_0", Key::Name);
+	const auto deep_sub_leaf = deep_sub.data_node().find("deep_leaf", Key::Name);
+	BOOST_TEST(abspath(deep_sub_leaf, Key::Name) == "/sub_0/deep_leaf");
+	deep_sub.rename("sub_renamed");
+	BOOST_TEST(abspath(deep_sub_leaf, Key::Name) == "/sub_renamed/deep_leaf");
+	deep_sub.rename("sub_0");
+	// ... and moves of ancestors
+	auto deep_outer = node();
+	deep_outer.insert(deep_sub);
+	deep_N.insert(hard_link("outer", deep_outer));
+	BOOST_TEST(abspath(deep_sub_leaf, Key::Name) == "/outer/sub_0/deep_leaf");
+	deep_N.insert(deep_sub);
+	BOOST_TEST(abspath(deep_sub_leaf, Key::Name) == "/sub_0/deep_leaf");
+	deep_N.erase("outer", Key::Name);
+
+	// sym link resolves cached target until path is modified
+	auto cache_N = node();
+	auto cache_sub = node();
+	const auto cache_leaf = hard_link("cache_leaf", std::make_shared<objbase>());
+	cache_sub.insert(cache_leaf);
+	const auto cache_sub_h = hard_link("cache_sub", cache_sub);
+	cache_N.insert(cache_sub_h);
+	auto cache_sym = sym_link("cache_sym", cache_leaf);
+	cache_N.insert(cache_sym);
+	BOOST_TEST(cache_sym.check_alive());
+	BOOST_TEST(cache_sym.check_alive());
+	cache_sub.erase(cache_leaf.id());
+	BOOST_TEST(!cache_sym.check_alive());
+	cache_sub.insert(cache_leaf);
+	BOOST_TEST(cache_sym.check_alive());
+
+	// parallel walk visits same nodes as sequential one
+	std::size_t n_walked = 0;
+	walk(hN, [&](const link&, std::list<link>&, links_v&) { ++n_walked; });
+	std::atomic<std::size_t> n_pwalked = 0;
+	const auto pwalk_step = [&](const link&, std::list<link>&, links_v&) { ++n_pwalked; };
+	walk(hN, pwalk_step, def_walk_opts, false);
+	BOOST_TEST(n_pwalked.load() == n_walked);
+	n_pwalked = 0;
+	walk(hN, pwalk_step, def_walk_opts | TreeOpts::WalkUp, true);
+	BOOST_TEST(n_pwalked.load() == n_walked);
+
+	// predicate queries over subtree
+	const auto is_person = query(bs_person::bs_type().name, Key::Type);
+	BOOST_TEST(search(hN, is_person && query::name_glob("Citizen_?")).size() == 10);
+	BOOST_TEST(search(hN, query("Citizen_1", Key::Name) || query("Citizen_2", Key::Name)).size() == 2);
+	BOOST_TEST(search(hN, query::name_glob("*Citizen_0") && query::obj_pred([](const sp_obj& obj) {
+		return obj->type_id() == bs_person::bs_type().name;
+	})).size() == 2);
+
+	// streaming walk delivers all leafs by batches
+	auto streamed = std::make_shared<std::promise<std::size_t>>();
+	walk(launch_async, hard_link("deep", deep_N),
+		[streamed, n = std::size_t{0}](const node& cur, const links_v& batch) mutable {
+			if(cur) n += batch.size();
+			else streamed->set_value(n);
+			return true;
+		}, 3
+	);
+	BOOST_TEST(streamed->get_future().get() == 8);
+
 	// serializze node
 	auto N1 = node();
 	test_json(N, N1);
@@ -0,0 +1,215 @@
+/// @file
+/// @author uentity
+/// @date 16.10.2026
+/// @brief Tree microbenchmarks
+/// @copyright
+/// This Source Code Form is subject to the terms of the Mozilla Public License,
+/// v. 2.0. If a copy of the MPL was not distributed with this file,
+/// You can obtain one at https://mozilla.org/MPL/2.0/
+
+#define BOOST_TEST_DYN_LINK
+
+#include <bs/actor_common.h>
+#include <bs/objbase.h>
+#include <bs/kernel/radio.h>
+#include <bs/tree/tree.h>
+
+#include <caf/actor_system.hpp>
+#include <caf/scoped_actor.hpp>
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace blue_sky;
+using namespace blue_sky::tree;
+namespace mi = boost::multi_index;
+using namespace std::chrono_literals;
+
+NAMESPACE_BEGIN()
+
+using bench_clock = std::chrono::steady_clock;
+
+// measure `f()` and print throughput of `n` operations
+template<typename F>
+auto bench(const char* what, std::size_t n, F&& f) {
+	const auto start = bench_clock::now();
+	f();
+	const auto dur = std::chrono::duration<double>(bench_clock::now() - start).count();
+	std::cout << what << ": " << n << " ops in " << dur << " s (" <<
+		std::size_t(dur > 0 ? n / dur : 0) << " ops/s)" << std::endl;
+	return dur;
+}
+
+// link paired with copy of it's name, mimics name stored inside link impl
+struct named_link {
+	link L;
+	std::string name;
+};
+
+// name key as it was before: copy name on every call
+struct name_copy_key {
+	using result_type = std::string;
+	auto operator()(const named_link& x) const -> std::string { return x.name; }
+};
+
+// name key used by node: reference to stored name
+struct name_ref_key {
+	using result_type = std::string;
+	auto operator()(const named_link& x) const -> const std::string& { return x.name; }
+};
+
+template<typename NameKey>
+using names_index = mi::multi_index_container<
+	named_link, mi::indexed_by< mi::ordered_non_unique<NameKey> >
+>;
+
+// links with long similarly-prefixed names that don't fit into SSO buffer
+auto make_links(std::size_t n) {
+	auto res = links_v{};
+	res.reserve(n);
+	for(std::size_t i = 0; i < n; ++i)
+		res.push_back(hard_link(
+			"similarly_prefixed_leaf_name_" + std::to_string(i), std::make_shared<objbase>()
+		));
+	return res;
+}
+
+NAMESPACE_END()
+
+// [NOTE] benchmarks are heavy & disabled by default, run them explicitly with
+// `bs_tests --run_test=@bench` or `bs_tests --run_test=test_tree_bench`
+BOOST_AUTO_TEST_CASE(test_tree_bench, * boost::unit_test::label("bench") * boost::unit_test::disabled()) {
+	std::cout << "\n\n*** tree microbenchmarks..." << std::endl;
+	std::cout << "*********************************************************************" << std::endl;
+
+	constexpr std::size_t n_leafs = 10000;
+	const auto leafs = make_links(n_leafs);
+
+	// 1. Name index insert throughput: name copying key vs key returning reference
+	auto named_leafs = std::vector<named_link>{};
+	named_leafs.reserve(n_leafs);
+	for(const auto& L : leafs)
+		named_leafs.push_back({L, L.name(unsafe)});
+	auto copy_idx = names_index<name_copy_key>{};
+	const auto copy_t = bench("Name index insert (copy key)", n_leafs, [&] {
+		for(const auto& x : named_leafs) copy_idx.insert(x);
+	});
+	auto ref_idx = names_index<name_ref_key>{};
+	const auto ref_t = bench("Name index insert (ref key) ", n_leafs, [&] {
+		for(const auto& x : named_leafs) ref_idx.insert(x);
+	});
+	BOOST_TEST(copy_idx.size() == ref_idx.size());
+	std::cout << "Name index insert speedup: " << (ref_t > 0 ? copy_t / ref_t : 0.) << std::endl;
+
+	// 2. node insert & find by name throughput
+	auto N = node();
+	bench("node insert", n_leafs, [&] {
+		for(const auto& L : leafs) N.insert(L);
+	});
+	BOOST_TEST(N.size() == n_leafs);
+
+	std::size_t n_found = 0;
+	bench("node find by name", n_leafs, [&] {
+		for(const auto& L : leafs)
+			n_found += bool(N.find(L.name(unsafe), Key::Name));
+	});
+	BOOST_TEST(n_found == n_leafs);
+
+	// 3. positional access (used by views per visible row)
+	std::size_t n_idx = 0;
+	bench("node find by index & index by ID", n_leafs, [&] {
+		for(std::size_t i = 0; i < n_leafs; ++i)
+			n_idx += N.index(N.find(i).id()) == i;
+	});
+	BOOST_TEST(n_idx == n_leafs);
+
+	// 4. bulk insert of fresh links
+	auto bulk_N = node();
+	auto bulk_leafs = make_links(n_leafs);
+	bench("node bulk insert", n_leafs, [&] {
+		BOOST_TEST(bulk_N.insert(std::move(bulk_leafs)) == n_leafs);
+	});
+
+	// 5. repeated deref of absolute paths: string vs compiled
+	auto deref_N = node();
+	deref_N.insert(hard_link("bulk", bulk_N));
+	auto paths = std::vector<std::string>{};
+	for(std::size_t i = 0; i < n_leafs; i += 10)
+		paths.push_back(abspath(bulk_N.find(i)));
+	auto cpaths = std::vector<compiled_path>{};
+	for(const auto& p : paths)
+		cpaths.emplace_back(p);
+
+	constexpr std::size_t n_derefs = 10;
+	std::size_t n_deref = 0;
+	bench("deref path (string)", n_derefs * paths.size(), [&] {
+		for(std::size_t k = 0; k < n_derefs; ++k)
+			for(const auto& p : paths)
+				n_deref += bool(deref_path(p, deref_N));
+	});
+	bench("deref path (compiled)", n_derefs * paths.size(), [&] {
+		for(std::size_t k = 0; k < n_derefs; ++k)
+			for(const auto& p : cpaths)
+				n_deref += bool(deref_path(p, deref_N));
+	});
+	BOOST_TEST(n_deref == 2 * n_derefs * paths.size());
+
+	// 6. latency of reads under background load: normal vs interactive requests
+	constexpr std::size_t n_background = 200, n_reads = 20;
+	const auto read_latency = [&](const char* what, bool interactive) {
+		// fill node's mailbox with slow background transactions
+		for(std::size_t i = 0; i < n_background; ++i)
+			N.apply(launch_async, [](bare_node) {
+				std::this_thread::sleep_for(1ms);
+				return perfect;
+			});
+
+		const auto prio = kernel::radio::interactive_scope{interactive};
+		auto total = bench_clock::duration{};
+		std::size_t n_ok = 0;
+		for(std::size_t i = 0; i < n_reads; ++i) {
+			const auto start = bench_clock::now();
+			n_ok += bool(N.find(leafs[i].name(unsafe), Key::Name));
+			total += bench_clock::now() - start;
+		}
+		BOOST_TEST(n_ok == n_reads);
+		const auto avg = std::chrono::duration<double, std::milli>(total).count() / n_reads;
+		std::cout << what << ": avg latency " << avg << " ms under " << n_background <<
+			" background transactions" << std::endl;
+
+		// wait until background load is processed
+		N.apply([](bare_node) { return perfect; });
+		return avg;
+	};
+	const auto normal_lat = read_latency("node find (normal)     ", false);
+	const auto inter_lat = read_latency("node find (interactive)", true);
+	std::cout << "Interactive reads latency gain: " << (inter_lat > 0 ? normal_lat / inter_lat : 0.) << std::endl;
+
+	// 7. tiny synchronous requests: fresh blocking actor per call vs actor reused by thread
+	constexpr std::size_t n_requests = 10000;
+	auto echo = kernel::radio::system().spawn([]() -> caf::behavior { return {
+		[](int x) { return x; }
+	}; });
+	const auto req_timeout = kernel::radio::timeout();
+	std::size_t n_echo = 0;
+	const auto fresh_t = bench("actorf (fresh caller) ", n_requests, [&] {
+		for(std::size_t i = 0; i < n_requests; ++i)
+			n_echo += actorf<int>(
+				caf::scoped_actor{kernel::radio::system()}, echo, req_timeout, int(i)
+			).value_or(-1) == int(i);
+	});
+	const auto pooled_t = bench("actorf (pooled caller)", n_requests, [&] {
+		for(std::size_t i = 0; i < n_requests; ++i)
+			n_echo += actorf<int>(echo, req_timeout, int(i)).value_or(-1) == int(i);
+	});
+	BOOST_TEST(n_echo == 2 * n_requests);
+	std::cout << "Pooled caller speedup: " << (pooled_t > 0 ? fresh_t / pooled_t : 0.) << std::endl;
+	caf::anon_send_exit(echo, caf::exit_reason::user_shutdown);
+}
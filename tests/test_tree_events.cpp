@@ -29,6 +29,7 @@
 #include <iostream>
 #include <thread>
 #include <chrono>
+#include <future>
 #include <atomic>
 #include <unordered_map>
 
@@ -160,4 +161,57 @@ BOOST_AUTO_TEST_CASE(test_tree_events) {
 	// summary
 	std::cout << "### status link->node calls: " << test_status(N1, L) << std::endl;
 	std::cout << "### status link->link calls: " << test_status(L, L) << std::endl;
+
+	/////////////////////////////////////////////////////////////////////////////////
+	//  bounded queue of slow subscriber
+	//
+	auto test_overflow = [](tree::link src, EventOverflow policy) {
+		auto h_slow = src.subscribe(
+			[](event) { std::this_thread::sleep_for(20ms); }, Event::LinkRenamed, {},
+			event_queue_opts{2, policy}
+		);
+		for(int i = 0; i < 20; ++i)
+			src.rename("Tyler " + std::to_string(i));
+		// wait until queue is drained: every event is either delivered, dropped or coalesced
+		auto stats = engine::subscriber_stats(h_slow);
+		const auto deadline = std::chrono::steady_clock::now() + 5s;
+		while(
+			(stats.pending || stats.delivered + stats.dropped + stats.coalesced < 20)
+			&& std::chrono::steady_clock::now() < deadline
+		) {
+			std::this_thread::sleep_for(1ms);
+			stats = engine::subscriber_stats(h_slow);
+		}
+		src.unsubscribe(h_slow);
+		BOOST_TEST(stats.pending == 0);
+		BOOST_TEST(stats.delivered + stats.dropped + stats.coalesced == 20);
+		return stats;
+	};
+	BOOST_TEST(test_overflow(L, EventOverflow::DropOldest).dropped > 0);
+	BOOST_TEST(test_overflow(L, EventOverflow::CoalesceLatest).coalesced > 0);
+
+	// stalled subscriber: all events leave listener's mailbox while memory is bounded by queue capacity
+	auto release = std::promise<void>();
+	auto released = release.get_future().share();
+	auto h_stalled = L.subscribe(
+		[=](event) { released.wait(); }, Event::LinkRenamed, {},
+		event_queue_opts{2, EventOverflow::DropOldest}
+	);
+	for(int i = 0; i < 100; ++i)
+		L.rename("Stalled " + std::to_string(i));
+	// single event is taken by stalled callback, others are either pending or dropped
+	auto stalled_stats = engine::subscriber_stats(h_stalled);
+	const auto deadline = std::chrono::steady_clock::now() + 5s;
+	while(
+		stalled_stats.delivered + stalled_stats.dropped + stalled_stats.pending < 100
+		&& std::chrono::steady_clock::now() < deadline
+	) {
+		std::this_thread::sleep_for(1ms);
+		stalled_stats = engine::subscriber_stats(h_stalled);
+	}
+	BOOST_TEST(stalled_stats.delivered == 1);
+	BOOST_TEST(stalled_stats.pending <= 2);
+	BOOST_TEST(stalled_stats.delivered + stalled_stats.dropped + stalled_stats.pending == 100);
+	release.set_value();
+	L.unsubscribe(h_stalled);
 }